@@ -0,0 +1,184 @@
+#ifndef LODASH_CHAIN_H
+#define LODASH_CHAIN_H
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./type_utility/push_back_to_container.h"
+#include "./type_utility/visit_container.h"
+
+namespace lodash {
+
+namespace type_utility {
+
+// InvokeStage calls a chain stage with the current element. Pair-like elements (e.g. the nodes of a map) can also be
+// consumed by a function taking key and value separately, just like VisitContainer does for maps.
+template <typename F, typename T>
+inline decltype(auto) InvokeStage(F& f, T&& t) {
+    if constexpr (std::is_invocable_v<F&, T&&>) {
+        return std::invoke(f, std::forward<T>(t));
+    } else {
+        return std::invoke(f, t.first, t.second);
+    }
+}
+
+template <typename F, typename T>
+using invoke_stage_result_t = decltype(InvokeStage(std::declval<F&>(), std::declval<T&>()));
+
+}  // namespace type_utility
+
+// LazyChain is a pipeline of Map / Filter / Reject stages over a source container.
+// Stages are composed into a single callable and nothing is evaluated until a terminal operation
+// (Value, Sum, Reduce, Count, ForEach) is called, so the whole chain runs in one pass over the source
+// without materializing intermediate containers.
+//
+// `Pipe` is a callable `pipe(element, sink) -> bool` that pushes the transformed element (if any) to `sink`
+// and returns true if the traversal needs to exit.
+template <typename Container, typename T, typename Pipe>
+class LazyChain {
+public:
+    using value_type = T;
+
+    LazyChain(Container&& c, Pipe&& pipe) : c_(std::forward<Container>(c)), pipe_(std::move(pipe)) {}
+
+    // Map transforms each element of the chain.
+    template <typename F>
+    auto Map(F&& f) && {
+        using result_type = std::decay_t<type_utility::invoke_stage_result_t<std::decay_t<F>, T>>;
+
+        auto pipe = [pipe = std::move(pipe_), f = std::forward<F>(f)](auto&& v, auto&& sink) mutable {
+            return pipe(std::forward<decltype(v)>(v), [&f, &sink](auto&& x) {
+                return sink(type_utility::InvokeStage(f, std::forward<decltype(x)>(x)));
+            });
+        };
+
+        return LazyChain<Container, result_type, decltype(pipe)>(std::forward<Container>(c_), std::move(pipe));
+    }
+
+    // Filter keeps the elements predicate returns truthy for.
+    template <typename F>
+    auto Filter(F&& f) && {
+        auto pipe = [pipe = std::move(pipe_), f = std::forward<F>(f)](auto&& v, auto&& sink) mutable {
+            return pipe(std::forward<decltype(v)>(v), [&f, &sink](auto&& x) {
+                if (type_utility::InvokeStage(f, x)) {
+                    return sink(std::forward<decltype(x)>(x));
+                }
+
+                return false;
+            });
+        };
+
+        return LazyChain<Container, T, decltype(pipe)>(std::forward<Container>(c_), std::move(pipe));
+    }
+
+    // Reject is the opposite of Filter, it keeps the elements predicate does not return truthy for.
+    template <typename F>
+    auto Reject(F&& f) && {
+        auto pipe = [pipe = std::move(pipe_), f = std::forward<F>(f)](auto&& v, auto&& sink) mutable {
+            return pipe(std::forward<decltype(v)>(v), [&f, &sink](auto&& x) {
+                if (!type_utility::InvokeStage(f, x)) {
+                    return sink(std::forward<decltype(x)>(x));
+                }
+
+                return false;
+            });
+        };
+
+        return LazyChain<Container, T, decltype(pipe)>(std::forward<Container>(c_), std::move(pipe));
+    }
+
+    // Value materializes the chain into a container, `std::vector<value_type>` by default.
+    template <typename R = std::vector<T>>
+    auto Value() && {
+        auto res = R();
+
+        std::move(*this).Run([&res](auto&& x) {
+            type_utility::PushBackToContainer(res, std::forward<decltype(x)>(x));
+            return false;
+        });
+
+        return res;
+    }
+
+    // Sum summarizes the elements of the chain.
+    auto Sum() && {
+        auto res = T();
+
+        std::move(*this).Run([&res](auto&& x) {
+            res += x;
+            return false;
+        });
+
+        return res;
+    }
+
+    // Reduce reduces the elements of the chain to a value, see lodash::Reduce.
+    template <typename F, typename I>
+    auto Reduce(F&& f, I&& init) && {
+        auto res = std::decay_t<I>(std::forward<I>(init));
+
+        std::move(*this).Run([&res, &f](auto&& x) {
+            res = f(res, std::forward<decltype(x)>(x));
+            return false;
+        });
+
+        return res;
+    }
+
+    // Count counts the elements which reach the end of the chain.
+    size_t Count() && {
+        size_t count = 0;
+
+        std::move(*this).Run([&count]([[maybe_unused]] auto&& x) {
+            ++count;
+            return false;
+        });
+
+        return count;
+    }
+
+    // ForEach invokes f for each element which reaches the end of the chain.
+    template <typename F>
+    void ForEach(F&& f) && {
+        std::move(*this).Run([&f](auto&& x) {
+            type_utility::InvokeStage(f, std::forward<decltype(x)>(x));
+            return false;
+        });
+    }
+
+private:
+    template <typename Sink>
+    void Run(Sink&& sink) && {
+        type_utility::VisitContainer(
+                std::forward<Container>(c_),
+                [this, &sink](auto&& v) {
+                    return pipe_(std::forward<decltype(v)>(v), sink);
+                },
+                []([[maybe_unused]] auto&& r, [[maybe_unused]] auto&& value, [[maybe_unused]] auto&& node_info) {
+                    return type_utility::ReturnInfo{.need_exit = r};
+                });
+    }
+
+private:
+    Container c_;
+    Pipe pipe_;
+};
+
+// Chain creates a lazy pipeline over the container, e.g. `Chain(c).Filter(p).Map(f).Sum()`.
+// An lvalue container is referenced, an rvalue container is moved into the chain.
+template <typename Container>
+inline auto Chain(Container&& c) {
+    using value_type = typename std::decay_t<Container>::value_type;
+
+    auto pipe = [](auto&& v, auto&& sink) {
+        return sink(std::forward<decltype(v)>(v));
+    };
+
+    return LazyChain<Container, value_type, decltype(pipe)>(std::forward<Container>(c), std::move(pipe));
+}
+
+}  // namespace lodash
+
+#endif  // LODASH_CHAIN_H
@@ -0,0 +1,539 @@
+#ifndef LODASH_CONTAINER_FLAT_HASH_SET_H
+#define LODASH_CONTAINER_FLAT_HASH_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace lodash::container {
+
+namespace flat_hash_set_internal {
+
+// Every slot has a control byte: kEmpty, kDeleted, or the low 7 bits of the hash of the element in the slot.
+using ctrl_t = int8_t;
+
+inline constexpr ctrl_t kEmpty = -128;
+inline constexpr ctrl_t kDeleted = -2;
+
+inline constexpr size_t kGroupWidth = 16;
+
+inline uint32_t CountTrailingZeros(uint32_t x) {
+#if defined(__GNUC__)
+    return static_cast<uint32_t>(__builtin_ctz(x));
+#else
+    uint32_t n = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        ++n;
+    }
+
+    return n;
+#endif
+}
+
+// Group is a window of kGroupWidth control bytes which are matched at once.
+class Group {
+public:
+    explicit Group(const ctrl_t* ctrl) {
+#if defined(__SSE2__)
+        ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+        for (size_t i = 0; i < kGroupWidth; i++) {
+            ctrl_[i] = ctrl[i];
+        }
+#endif
+    }
+
+    // Match returns a bitmask of the slots whose control byte is h2.
+    uint32_t Match(ctrl_t h2) const {
+#if defined(__SSE2__)
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kGroupWidth; i++) {
+            mask |= static_cast<uint32_t>(ctrl_[i] == h2) << i;
+        }
+
+        return mask;
+#endif
+    }
+
+    uint32_t MatchEmpty() const {
+        return Match(kEmpty);
+    }
+
+    // MatchEmptyOrDeleted relies on full control bytes being non-negative.
+    uint32_t MatchEmptyOrDeleted() const {
+#if defined(__SSE2__)
+        return static_cast<uint32_t>(_mm_movemask_epi8(ctrl_));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kGroupWidth; i++) {
+            mask |= static_cast<uint32_t>(ctrl_[i] < 0) << i;
+        }
+
+        return mask;
+#endif
+    }
+
+private:
+#if defined(__SSE2__)
+    __m128i ctrl_;
+#else
+    ctrl_t ctrl_[kGroupWidth];
+#endif
+};
+
+// Mix spreads the bits of a hash value, std::hash of integers is usually the identity.
+inline size_t Mix(size_t h) {
+    auto x = static_cast<uint64_t>(h);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return static_cast<size_t>(x);
+}
+
+}  // namespace flat_hash_set_internal
+
+// FlatHashSet is an open-addressing hash set in the style of SwissTable.
+//
+// Elements are stored inline in one array of slots, next to an array of one-byte control words. A lookup hashes the
+// key once, uses the high bits to pick a group of 16 slots and compares the low 7 bits against all 16 control bytes
+// of the group at once, so most lookups touch one cache line of control bytes and one slot. The capacity is a power of
+// two and the maximum load factor is 7/8.
+template <typename T,
+          typename Hash = std::hash<T>,
+          typename KeyEqual = std::equal_to<T>,
+          typename Allocator = std::allocator<T>>
+class FlatHashSet {
+private:
+    using ctrl_t = flat_hash_set_internal::ctrl_t;
+    using Group = flat_hash_set_internal::Group;
+
+    using slot_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using slot_traits = std::allocator_traits<slot_allocator_type>;
+    using ctrl_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<ctrl_t>;
+    using ctrl_traits = std::allocator_traits<ctrl_allocator_type>;
+
+    static constexpr size_t kGroupWidth = flat_hash_set_internal::kGroupWidth;
+
+public:
+    using key_type = T;
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Allocator;
+    using reference = const T&;
+    using const_reference = const T&;
+
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+
+        reference operator*() const {
+            return set_->slots_[ix_];
+        }
+
+        pointer operator->() const {
+            return &set_->slots_[ix_];
+        }
+
+        const_iterator& operator++() {
+            ++ix_;
+            SkipEmpty();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            auto it = *this;
+            ++*this;
+            return it;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return ix_ == other.ix_;
+        }
+
+        bool operator!=(const const_iterator& other) const {
+            return ix_ != other.ix_;
+        }
+
+    private:
+        friend class FlatHashSet;
+
+        const_iterator(const FlatHashSet* set, size_t ix) : set_(set), ix_(ix) {
+            SkipEmpty();
+        }
+
+        void SkipEmpty() {
+            while (ix_ < set_->capacity_ && set_->ctrl_[ix_] < 0) {
+                ++ix_;
+            }
+        }
+
+        const FlatHashSet* set_{nullptr};
+        size_t ix_{0};
+    };
+
+    using iterator = const_iterator;
+
+    FlatHashSet() : FlatHashSet(0) {}
+
+    // bucket_count is a hint of the number of elements, the set is sized so that they fit without rehashing.
+    explicit FlatHashSet(size_type bucket_count,
+                         const Hash& hash = Hash(),
+                         const KeyEqual& eq = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+            : hash_(hash), eq_(eq), slot_alloc_(alloc), ctrl_alloc_(alloc) {
+        reserve(bucket_count);
+    }
+
+    explicit FlatHashSet(const Allocator& alloc) : FlatHashSet(0, Hash(), KeyEqual(), alloc) {}
+
+    FlatHashSet(size_type bucket_count, const Allocator& alloc)
+            : FlatHashSet(bucket_count, Hash(), KeyEqual(), alloc) {}
+
+    FlatHashSet(const FlatHashSet& other)
+            : FlatHashSet(other.size(),
+                          other.hash_,
+                          other.eq_,
+                          slot_traits::select_on_container_copy_construction(other.slot_alloc_)) {
+        for (auto&& v : other) {
+            InsertUnique(v);
+        }
+    }
+
+    FlatHashSet(FlatHashSet&& other) noexcept
+            : hash_(std::move(other.hash_)),
+              eq_(std::move(other.eq_)),
+              slot_alloc_(std::move(other.slot_alloc_)),
+              ctrl_alloc_(std::move(other.ctrl_alloc_)),
+              ctrl_(std::exchange(other.ctrl_, nullptr)),
+              slots_(std::exchange(other.slots_, nullptr)),
+              capacity_(std::exchange(other.capacity_, 0)),
+              size_(std::exchange(other.size_, 0)),
+              growth_left_(std::exchange(other.growth_left_, 0)) {}
+
+    FlatHashSet& operator=(const FlatHashSet& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size());
+            for (auto&& v : other) {
+                InsertUnique(v);
+            }
+        }
+
+        return *this;
+    }
+
+    FlatHashSet& operator=(FlatHashSet&& other) noexcept(
+            slot_traits::propagate_on_container_move_assignment::value || slot_traits::is_always_equal::value) {
+        if (this == &other) {
+            return *this;
+        }
+
+        Destroy();
+        hash_ = std::move(other.hash_);
+        eq_ = std::move(other.eq_);
+
+        if constexpr (slot_traits::propagate_on_container_move_assignment::value) {
+            slot_alloc_ = std::move(other.slot_alloc_);
+            ctrl_alloc_ = std::move(other.ctrl_alloc_);
+        } else if (slot_alloc_ != other.slot_alloc_) {
+            // The storage of other can't be released by our allocator, move the elements one by one.
+            reserve(other.size());
+            for (size_t i = 0; i < other.capacity_; i++) {
+                if (other.ctrl_[i] >= 0) {
+                    InsertUnique(std::move(other.slots_[i]));
+                }
+            }
+
+            other.Destroy();
+            return *this;
+        }
+
+        ctrl_ = std::exchange(other.ctrl_, nullptr);
+        slots_ = std::exchange(other.slots_, nullptr);
+        capacity_ = std::exchange(other.capacity_, 0);
+        size_ = std::exchange(other.size_, 0);
+        growth_left_ = std::exchange(other.growth_left_, 0);
+
+        return *this;
+    }
+
+    ~FlatHashSet() {
+        Destroy();
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, capacity_);
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    size_type size() const {
+        return size_;
+    }
+
+    size_type capacity() const {
+        return capacity_;
+    }
+
+    allocator_type get_allocator() const {
+        return allocator_type(slot_alloc_);
+    }
+
+    void clear() {
+        for (size_t i = 0; i < capacity_; i++) {
+            if (ctrl_[i] >= 0) {
+                slot_traits::destroy(slot_alloc_, slots_ + i);
+                ctrl_[i] = flat_hash_set_internal::kEmpty;
+            }
+        }
+
+        size_ = 0;
+        growth_left_ = MaxLoad(capacity_);
+    }
+
+    // reserve makes room for at least n elements without rehashing.
+    void reserve(size_type n) {
+        if (n > MaxLoad(capacity_)) {
+            Rehash(CapacityFor(n));
+        }
+    }
+
+    template <typename K>
+    std::pair<iterator, bool> insert(K&& key) {
+        auto h = flat_hash_set_internal::Mix(hash_(key));
+
+        auto ix = Find(key, h);
+        if (ix != capacity_) {
+            return {iterator(this, ix), false};
+        }
+
+        return {iterator(this, InsertAt(h, std::forward<K>(key))), true};
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(T(std::forward<Args>(args)...));
+    }
+
+    iterator find(const T& key) const {
+        if (size_ == 0) {
+            return end();
+        }
+
+        return iterator(this, Find(key, flat_hash_set_internal::Mix(hash_(key))));
+    }
+
+    size_type count(const T& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    bool contains(const T& key) const {
+        return size_ != 0 && Find(key, flat_hash_set_internal::Mix(hash_(key))) != capacity_;
+    }
+
+    size_type erase(const T& key) {
+        if (size_ == 0) {
+            return 0;
+        }
+
+        auto ix = Find(key, flat_hash_set_internal::Mix(hash_(key)));
+        if (ix == capacity_) {
+            return 0;
+        }
+
+        slot_traits::destroy(slot_alloc_, slots_ + ix);
+        ctrl_[ix] = flat_hash_set_internal::kDeleted;
+        --size_;
+
+        return 1;
+    }
+
+private:
+    static size_t MaxLoad(size_t capacity) {
+        return capacity - capacity / 8;
+    }
+
+    static size_t CapacityFor(size_t n) {
+        size_t capacity = kGroupWidth;
+        while (MaxLoad(capacity) < n) {
+            capacity *= 2;
+        }
+
+        return capacity;
+    }
+
+    static size_t H1(size_t h) {
+        return h >> 7;
+    }
+
+    static ctrl_t H2(size_t h) {
+        return static_cast<ctrl_t>(h & 0x7F);
+    }
+
+    // Probe visits the groups in triangular order, which covers every group when the group count is a power of two.
+    // `f(group_begin, group)` returns true to stop probing.
+    template <typename F>
+    void Probe(size_t h, F&& f) const {
+        auto group_mask = capacity_ / kGroupWidth - 1;
+        auto group_ix = H1(h) & group_mask;
+
+        for (size_t step = 1;; step++) {
+            auto group_begin = group_ix * kGroupWidth;
+            if (f(group_begin, Group(ctrl_ + group_begin))) {
+                return;
+            }
+
+            group_ix = (group_ix + step) & group_mask;
+        }
+    }
+
+    // Find returns the slot index of key, or capacity_ if it is not present.
+    template <typename K>
+    size_t Find(const K& key, size_t h) const {
+        if (capacity_ == 0) {
+            return capacity_;
+        }
+
+        auto res = capacity_;
+        Probe(h, [&](size_t group_begin, const Group& g) {
+            for (auto mask = g.Match(H2(h)); mask != 0; mask &= mask - 1) {
+                auto ix = group_begin + flat_hash_set_internal::CountTrailingZeros(mask);
+                if (eq_(slots_[ix], key)) {
+                    res = ix;
+                    return true;
+                }
+            }
+
+            return g.MatchEmpty() != 0;
+        });
+
+        return res;
+    }
+
+    // FindInsertSlot returns the first empty or deleted slot on the probe sequence of h.
+    size_t FindInsertSlot(size_t h) const {
+        auto res = capacity_;
+        Probe(h, [&res](size_t group_begin, const Group& g) {
+            auto mask = g.MatchEmptyOrDeleted();
+            if (mask != 0) {
+                res = group_begin + flat_hash_set_internal::CountTrailingZeros(mask);
+                return true;
+            }
+
+            return false;
+        });
+
+        return res;
+    }
+
+    template <typename K>
+    size_t InsertAt(size_t h, K&& key) {
+        if (growth_left_ == 0) {
+            Rehash(CapacityFor(size_ + 1));
+        }
+
+        auto ix = FindInsertSlot(h);
+        if (ctrl_[ix] == flat_hash_set_internal::kEmpty) {
+            --growth_left_;
+        }
+
+        slot_traits::construct(slot_alloc_, slots_ + ix, std::forward<K>(key));
+        ctrl_[ix] = H2(h);
+        ++size_;
+
+        return ix;
+    }
+
+    template <typename K>
+    void InsertUnique(K&& key) {
+        InsertAt(flat_hash_set_internal::Mix(hash_(key)), std::forward<K>(key));
+    }
+
+    void Rehash(size_t new_capacity) {
+        auto old_ctrl = ctrl_;
+        auto old_slots = slots_;
+        auto old_capacity = capacity_;
+
+        ctrl_ = ctrl_traits::allocate(ctrl_alloc_, new_capacity);
+        slots_ = slot_traits::allocate(slot_alloc_, new_capacity);
+        capacity_ = new_capacity;
+        growth_left_ = MaxLoad(new_capacity) - size_;
+
+        for (size_t i = 0; i < new_capacity; i++) {
+            ctrl_[i] = flat_hash_set_internal::kEmpty;
+        }
+
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (old_ctrl[i] >= 0) {
+                auto h = flat_hash_set_internal::Mix(hash_(old_slots[i]));
+                auto ix = FindInsertSlot(h);
+
+                slot_traits::construct(slot_alloc_, slots_ + ix, std::move(old_slots[i]));
+                slot_traits::destroy(slot_alloc_, old_slots + i);
+                ctrl_[ix] = H2(h);
+            }
+        }
+
+        if (old_capacity > 0) {
+            ctrl_traits::deallocate(ctrl_alloc_, old_ctrl, old_capacity);
+            slot_traits::deallocate(slot_alloc_, old_slots, old_capacity);
+        }
+    }
+
+    void Destroy() {
+        if (capacity_ == 0) {
+            return;
+        }
+
+        clear();
+        ctrl_traits::deallocate(ctrl_alloc_, ctrl_, capacity_);
+        slot_traits::deallocate(slot_alloc_, slots_, capacity_);
+
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+        capacity_ = 0;
+        growth_left_ = 0;
+    }
+
+private:
+    Hash hash_;
+    KeyEqual eq_;
+    slot_allocator_type slot_alloc_;
+    ctrl_allocator_type ctrl_alloc_;
+
+    ctrl_t* ctrl_{nullptr};
+    T* slots_{nullptr};
+    size_t capacity_{0};
+    size_t size_{0};
+    size_t growth_left_{0};
+};
+
+}  // namespace lodash::container
+
+#endif  // LODASH_CONTAINER_FLAT_HASH_SET_H
@@ -0,0 +1,138 @@
+#ifndef LODASH_CONTAINER_FLATTEN_RANGE_H
+#define LODASH_CONTAINER_FLATTEN_RANGE_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../type_check/is_iterable.h"
+#include "../type_utility/get_flatten_container_value_type.h"
+
+namespace lodash::container {
+
+template <typename Iterator, size_t Depth>
+class FlattenIterator;
+
+namespace flatten_range_internal {
+
+template <typename Iterator>
+using element_t = std::decay_t<decltype(*std::declval<Iterator&>())>;
+
+// MakeIterator returns first itself if there is no level left to flatten below it, otherwise a FlattenIterator over
+// [first, last).
+template <size_t Depth, typename Iterator>
+inline auto MakeIterator(Iterator first, Iterator last) {
+    if constexpr (Depth > 0 && type_check::is_iterable<element_t<Iterator>>) {
+        return FlattenIterator<Iterator, Depth>(first, last);
+    } else {
+        return first;
+    }
+}
+
+template <size_t Depth, typename Iterator>
+using iterator_t = decltype(MakeIterator<Depth>(std::declval<Iterator>(), std::declval<Iterator>()));
+
+}  // namespace flatten_range_internal
+
+// FlattenIterator walks the elements of the ranges [first, last) refers to, Depth levels of them flattened. It skips
+// the empty inner ranges, so it always refers to an element or to the end.
+template <typename Iterator, size_t Depth>
+class FlattenIterator {
+public:
+    using outer_reference = decltype(*std::declval<Iterator&>());
+    using inner_iterator =
+            flatten_range_internal::iterator_t<Depth - 1, decltype(std::begin(std::declval<outer_reference>()))>;
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::iterator_traits<inner_iterator>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::iterator_traits<inner_iterator>::pointer;
+    using reference = typename std::iterator_traits<inner_iterator>::reference;
+
+    FlattenIterator() = default;
+
+    FlattenIterator(Iterator first, Iterator last) : outer_(first), last_(last) {
+        if (outer_ != last_) {
+            ResetInner();
+            SkipEmpty();
+        }
+    }
+
+    reference operator*() const {
+        return *inner_;
+    }
+
+    pointer operator->() const {
+        return &*inner_;
+    }
+
+    FlattenIterator& operator++() {
+        ++inner_;
+        SkipEmpty();
+        return *this;
+    }
+
+    FlattenIterator operator++(int) {
+        auto res = *this;
+        ++*this;
+        return res;
+    }
+
+    bool operator==(const FlattenIterator& other) const {
+        return outer_ == other.outer_ && (outer_ == last_ || inner_ == other.inner_);
+    }
+
+    bool operator!=(const FlattenIterator& other) const {
+        return !(*this == other);
+    }
+
+private:
+    void ResetInner() {
+        auto&& v = *outer_;
+        inner_ = flatten_range_internal::MakeIterator<Depth - 1>(std::begin(v), std::end(v));
+        inner_last_ = flatten_range_internal::MakeIterator<Depth - 1>(std::end(v), std::end(v));
+    }
+
+    void SkipEmpty() {
+        while (inner_ == inner_last_) {
+            if (++outer_ == last_) {
+                return;
+            }
+
+            ResetInner();
+        }
+    }
+
+    Iterator outer_{};
+    Iterator last_{};
+    inner_iterator inner_{};
+    inner_iterator inner_last_{};
+};
+
+// FlattenRange is a forward range over the elements of a nested container with Depth levels of it flattened. Unlike
+// Flatten, it neither copies the elements nor allocates, which suits the callers which only iterate. It refers
+// to the container, so the container must outlive it and its elements are modifiable through it if it is not const.
+template <typename Container, size_t Depth = type_utility::kFlattenFullDepth>
+class FlattenRange {
+public:
+    explicit FlattenRange(Container& c) : c_(c) {}
+
+    auto begin() const {
+        return flatten_range_internal::MakeIterator<Depth>(std::begin(c_), std::end(c_));
+    }
+
+    auto end() const {
+        return flatten_range_internal::MakeIterator<Depth>(std::end(c_), std::end(c_));
+    }
+
+    bool empty() const {
+        return begin() == end();
+    }
+
+private:
+    Container& c_;
+};
+
+}  // namespace lodash::container
+
+#endif  // LODASH_CONTAINER_FLATTEN_RANGE_H
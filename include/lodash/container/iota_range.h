@@ -0,0 +1,180 @@
+#ifndef LODASH_CONTAINER_IOTA_RANGE_H
+#define LODASH_CONTAINER_IOTA_RANGE_H
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "../type_utility/iota.h"
+
+namespace lodash::container {
+
+// IotaIterator is the random access iterator of IotaRange. It computes the values it refers to, so it yields them by
+// value and has no pointer type.
+template <typename T>
+class IotaIterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = T;
+
+    constexpr IotaIterator() = default;
+
+    constexpr IotaIterator(T start, T step, size_t ix) : start_(start), step_(step), ix_(ix) {}
+
+    constexpr reference operator*() const {
+        return type_utility::IotaValue(start_, step_, ix_);
+    }
+
+    constexpr reference operator[](difference_type n) const {
+        return type_utility::IotaValue(start_, step_, ix_ + n);
+    }
+
+    constexpr IotaIterator& operator++() {
+        ++ix_;
+        return *this;
+    }
+
+    constexpr IotaIterator operator++(int) {
+        auto res = *this;
+        ++ix_;
+        return res;
+    }
+
+    constexpr IotaIterator& operator--() {
+        --ix_;
+        return *this;
+    }
+
+    constexpr IotaIterator operator--(int) {
+        auto res = *this;
+        --ix_;
+        return res;
+    }
+
+    constexpr IotaIterator& operator+=(difference_type n) {
+        ix_ += n;
+        return *this;
+    }
+
+    constexpr IotaIterator& operator-=(difference_type n) {
+        ix_ -= n;
+        return *this;
+    }
+
+    friend constexpr IotaIterator operator+(IotaIterator it, difference_type n) {
+        return it += n;
+    }
+
+    friend constexpr IotaIterator operator+(difference_type n, IotaIterator it) {
+        return it += n;
+    }
+
+    friend constexpr IotaIterator operator-(IotaIterator it, difference_type n) {
+        return it -= n;
+    }
+
+    friend constexpr difference_type operator-(const IotaIterator& a, const IotaIterator& b) {
+        return static_cast<difference_type>(a.ix_ - b.ix_);
+    }
+
+    // The iterators are compared by position, only iterators of the same range are comparable.
+    friend constexpr bool operator==(const IotaIterator& a, const IotaIterator& b) {
+        return a.ix_ == b.ix_;
+    }
+
+    friend constexpr bool operator!=(const IotaIterator& a, const IotaIterator& b) {
+        return a.ix_ != b.ix_;
+    }
+
+    friend constexpr bool operator<(const IotaIterator& a, const IotaIterator& b) {
+        return a.ix_ < b.ix_;
+    }
+
+    friend constexpr bool operator>(const IotaIterator& a, const IotaIterator& b) {
+        return a.ix_ > b.ix_;
+    }
+
+    friend constexpr bool operator<=(const IotaIterator& a, const IotaIterator& b) {
+        return a.ix_ <= b.ix_;
+    }
+
+    friend constexpr bool operator>=(const IotaIterator& a, const IotaIterator& b) {
+        return a.ix_ >= b.ix_;
+    }
+
+private:
+    T start_{};
+    T step_{};
+    size_t ix_{0};
+};
+
+// IotaRange is a read-only random access range of the numbers from start up to, but not including, stop by step, see
+// type_utility::IotaSize. It holds the bounds only and computes the values as they are read, so it takes constant
+// memory whatever its size. The algorithms returning a container of the input type return a std::vector<T>.
+template <typename T>
+class IotaRange {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T;
+    using const_reference = T;
+    using iterator = IotaIterator<T>;
+    using const_iterator = IotaIterator<T>;
+
+    // result_container is the container the algorithms build from an IotaRange, which is read-only.
+    using result_container = std::vector<T>;
+
+    constexpr IotaRange() = default;
+
+    constexpr IotaRange(T start, T stop, T step)
+            : start_(start), step_(step), size_(type_utility::IotaSize(start, stop, step)) {}
+
+    constexpr size_type size() const {
+        return size_;
+    }
+
+    constexpr bool empty() const {
+        return size_ == 0;
+    }
+
+    constexpr const_reference operator[](size_type ix) const {
+        return type_utility::IotaValue(start_, step_, ix);
+    }
+
+    constexpr const_reference front() const {
+        return start_;
+    }
+
+    constexpr const_reference back() const {
+        return (*this)[size_ - 1];
+    }
+
+    constexpr const_iterator begin() const {
+        return const_iterator(start_, step_, 0);
+    }
+
+    constexpr const_iterator end() const {
+        return const_iterator(start_, step_, size_);
+    }
+
+    constexpr const_iterator cbegin() const {
+        return begin();
+    }
+
+    constexpr const_iterator cend() const {
+        return end();
+    }
+
+private:
+    T start_{};
+    T step_{};
+    size_type size_{0};
+};
+
+}  // namespace lodash::container
+
+#endif  // LODASH_CONTAINER_IOTA_RANGE_H
@@ -0,0 +1,176 @@
+#ifndef LODASH_CONTAINER_MAPPED_ARRAY_H
+#define LODASH_CONTAINER_MAPPED_ARRAY_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lodash::container {
+
+// MappedArray is a read-only array of the fixed-width records of T stored in a file, which it maps in memory instead
+// of reading. It is a contiguous container of value_type T, so the lodash algorithms run over the file directly
+// without copying it, and the pages are read by the kernel as the algorithms walk them. The algorithms returning a
+// container of the input type return a std::vector<T>, see result_container.
+//
+// It is POSIX only: the file is mapped with mmap and the kernel is advised of the access pattern with madvise.
+template <typename T>
+class MappedArray {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedArray requires a trivially copyable T");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using const_reference = const T&;
+    using pointer = const T*;
+    using const_pointer = const T*;
+    using iterator = const T*;
+    using const_iterator = const T*;
+
+    // result_container is the container the algorithms build from a MappedArray, which is read-only.
+    using result_container = std::vector<T>;
+
+    // Access is the order the elements are expected to be visited in: kSequential makes the kernel read ahead
+    // aggressively and start reading the file right away, kRandom disables the read-ahead.
+    enum class Access {
+        kSequential,
+        kRandom,
+    };
+
+    MappedArray() = default;
+
+    // MappedArray maps the file at path, it throws std::system_error if the file cannot be opened or mapped and
+    // std::invalid_argument if its size is not a multiple of sizeof(T).
+    explicit MappedArray(const std::string& path, Access access = Access::kSequential) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "open " + path);
+        }
+
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            auto err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(), "fstat " + path);
+        }
+
+        auto bytes = static_cast<size_t>(st.st_size);
+        if (bytes % sizeof(T) != 0) {
+            ::close(fd);
+            throw std::invalid_argument(path + ": size " + std::to_string(bytes) + " is not a multiple of " +
+                                        std::to_string(sizeof(T)));
+        }
+
+        // mmap rejects a length of 0, an empty file is an empty array.
+        if (bytes == 0) {
+            ::close(fd);
+            return;
+        }
+
+        void* p = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        auto err = errno;
+
+        // The mapping keeps the file open.
+        ::close(fd);
+
+        if (p == MAP_FAILED) {
+            throw std::system_error(err, std::generic_category(), "mmap " + path);
+        }
+
+        // The advice is only a hint, failing to give it is not an error.
+        if (access == Access::kSequential) {
+            ::madvise(p, bytes, MADV_SEQUENTIAL);
+            ::madvise(p, bytes, MADV_WILLNEED);
+        } else {
+            ::madvise(p, bytes, MADV_RANDOM);
+        }
+
+        data_ = static_cast<const T*>(p);
+        size_ = bytes / sizeof(T);
+    }
+
+    MappedArray(const MappedArray&) = delete;
+    MappedArray& operator=(const MappedArray&) = delete;
+
+    MappedArray(MappedArray&& other) noexcept
+            : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    MappedArray& operator=(MappedArray&& other) noexcept {
+        if (this != &other) {
+            Unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+
+        return *this;
+    }
+
+    ~MappedArray() {
+        Unmap();
+    }
+
+    const T* data() const {
+        return data_;
+    }
+
+    size_type size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    const_reference operator[](size_type ix) const {
+        return data_[ix];
+    }
+
+    const_reference front() const {
+        return data_[0];
+    }
+
+    const_reference back() const {
+        return data_[size_ - 1];
+    }
+
+    const_iterator begin() const {
+        return data_;
+    }
+
+    const_iterator end() const {
+        return data_ + size_;
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+private:
+    void Unmap() {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<T*>(data_), size_ * sizeof(T));
+        }
+    }
+
+    const T* data_{nullptr};
+    size_type size_{0};
+};
+
+}  // namespace lodash::container
+
+#endif  // LODASH_CONTAINER_MAPPED_ARRAY_H
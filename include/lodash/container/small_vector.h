@@ -0,0 +1,377 @@
+#ifndef LODASH_CONTAINER_SMALL_VECTOR_H
+#define LODASH_CONTAINER_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lodash::container {
+
+// SmallVector is a vector which stores up to N elements inline and moves them to the heap when it grows beyond, so
+// the short results of the algorithms never allocate, e.g. `Filter<SmallVector<int, 16>>(c, f)`. Past N it grows
+// geometrically like std::vector. Unlike container::StaticVector, the elements are only constructed when they are
+// added and T needs not be default constructible. Moving a SmallVector moves its elements one by one while they are
+// inline, so the iterators are invalidated by a move as well.
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(N > 0, "SmallVector needs an inline capacity, use std::vector otherwise");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() = default;
+
+    explicit SmallVector(size_type n) {
+        resize(n);
+    }
+
+    SmallVector(size_type n, const T& v) {
+        resize(n, v);
+    }
+
+    template <typename It,
+              std::enable_if_t<std::is_base_of_v<std::input_iterator_tag,
+                                                 typename std::iterator_traits<It>::iterator_category>,
+                               bool> = true>
+    SmallVector(It first, It last) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    SmallVector(std::initializer_list<T> il) : SmallVector(il.begin(), il.end()) {}
+
+    SmallVector(const SmallVector& other) : SmallVector(other.begin(), other.end()) {}
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        Steal(other);
+    }
+
+    ~SmallVector() {
+        Release();
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+
+            // size_ follows the copies, so that the ones made before a copy throws are destroyed with the others.
+            for (const auto& v : other) {
+                ::new (static_cast<void*>(data_ + size_)) T(v);
+                ++size_;
+            }
+        }
+
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            Release();
+            data_ = InlineData();
+            size_ = 0;
+            capacity_ = N;
+            Steal(other);
+        }
+
+        return *this;
+    }
+
+    // inline_capacity is the number of elements stored without allocating.
+    static constexpr size_type inline_capacity() {
+        return N;
+    }
+
+    // is_inline returns whether the elements are stored inline, i.e. the SmallVector has not allocated.
+    bool is_inline() const {
+        return data_ == InlineData();
+    }
+
+    size_type size() const {
+        return size_;
+    }
+
+    size_type capacity() const {
+        return capacity_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    T* data() {
+        return data_;
+    }
+
+    const T* data() const {
+        return data_;
+    }
+
+    reference operator[](size_type ix) {
+        return data_[ix];
+    }
+
+    const_reference operator[](size_type ix) const {
+        return data_[ix];
+    }
+
+    reference front() {
+        return data_[0];
+    }
+
+    const_reference front() const {
+        return data_[0];
+    }
+
+    reference back() {
+        return data_[size_ - 1];
+    }
+
+    const_reference back() const {
+        return data_[size_ - 1];
+    }
+
+    iterator begin() {
+        return data_;
+    }
+
+    const_iterator begin() const {
+        return data_;
+    }
+
+    iterator end() {
+        return data_ + size_;
+    }
+
+    const_iterator end() const {
+        return data_ + size_;
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    // reserve makes room for n elements, moving them to the heap if n exceeds the inline capacity.
+    void reserve(size_type n) {
+        if (n > capacity_) {
+            Reallocate(n);
+        }
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            return GrowAndEmplaceBack(std::forward<Args>(args)...);
+        }
+
+        auto* p = ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *p;
+    }
+
+    void push_back(const T& v) {
+        emplace_back(v);
+    }
+
+    void push_back(T&& v) {
+        emplace_back(std::move(v));
+    }
+
+    void pop_back() {
+        --size_;
+        std::destroy_at(data_ + size_);
+    }
+
+    // resize sets the size to n, the elements past the previous size are value-initialized as with std::vector.
+    void resize(size_type n) {
+        ResizeWith(n, [](T* p) {
+            ::new (static_cast<void*>(p)) T();
+        });
+    }
+
+    void resize(size_type n, const T& v) {
+        // v may be one of the elements, which growing the storage moves away, so it is copied beforehand.
+        if (n > capacity_) {
+            auto copy = T(v);
+            ResizeWith(n, [&copy](T* p) {
+                ::new (static_cast<void*>(p)) T(copy);
+            });
+
+            return;
+        }
+
+        ResizeWith(n, [&v](T* p) {
+            ::new (static_cast<void*>(p)) T(v);
+        });
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        auto* out = data_ + (first - data_);
+        if (first != last) {
+            auto* tail = std::move(data_ + (last - data_), end(), out);
+            std::destroy(tail, end());
+            size_ = static_cast<size_type>(tail - data_);
+        }
+
+        return out;
+    }
+
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    // clear destroys the elements, the storage is kept.
+    void clear() {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    friend bool operator==(const SmallVector& a, const SmallVector& b) {
+        return a.size_ == b.size_ && std::equal(a.begin(), a.end(), b.begin());
+    }
+
+    friend bool operator!=(const SmallVector& a, const SmallVector& b) {
+        return !(a == b);
+    }
+
+private:
+    T* InlineData() {
+        return reinterpret_cast<T*>(inline_);
+    }
+
+    const T* InlineData() const {
+        return reinterpret_cast<const T*>(inline_);
+    }
+
+    // Steal takes the elements of other, its heap storage if it has one, and leaves it empty. The SmallVector must be
+    // empty and inline.
+    void Steal(SmallVector& other) {
+        if (other.is_inline()) {
+            std::uninitialized_move(other.begin(), other.end(), data_);
+            size_ = other.size_;
+            other.clear();
+            return;
+        }
+
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.data_ = other.InlineData();
+        other.size_ = 0;
+        other.capacity_ = N;
+    }
+
+    // Release destroys the elements and frees the heap storage, leaving the SmallVector to be reset by the caller.
+    void Release() {
+        clear();
+        if (!is_inline()) {
+            std::allocator<T>().deallocate(data_, capacity_);
+        }
+    }
+
+    size_type NextCapacity(size_type n) const {
+        return std::max(n, 2 * capacity_);
+    }
+
+    // Relocate moves the elements to p, a storage of at least size_ elements, and destroys them at their old place.
+    // The elements are copied rather than moved if moving them may throw, as with std::vector.
+    void Relocate(T* p) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move(begin(), end(), p);
+        } else {
+            std::uninitialized_copy(begin(), end(), p);
+        }
+
+        std::destroy(begin(), end());
+    }
+
+    void Adopt(T* p, size_type capacity) {
+        if (!is_inline()) {
+            std::allocator<T>().deallocate(data_, capacity_);
+        }
+
+        data_ = p;
+        capacity_ = capacity;
+    }
+
+    void Reallocate(size_type capacity) {
+        auto* p = std::allocator<T>().allocate(capacity);
+        try {
+            Relocate(p);
+        } catch (...) {
+            std::allocator<T>().deallocate(p, capacity);
+            throw;
+        }
+
+        Adopt(p, capacity);
+    }
+
+    // GrowAndEmplaceBack constructs the new element in the new storage before relocating the others, args may refer
+    // to one of them.
+    template <typename... Args>
+    reference GrowAndEmplaceBack(Args&&... args) {
+        auto capacity = NextCapacity(size_ + 1);
+        auto* p = std::allocator<T>().allocate(capacity);
+        T* res = nullptr;
+
+        try {
+            res = ::new (static_cast<void*>(p + size_)) T(std::forward<Args>(args)...);
+            Relocate(p);
+        } catch (...) {
+            if (res != nullptr) {
+                std::destroy_at(res);
+            }
+
+            std::allocator<T>().deallocate(p, capacity);
+            throw;
+        }
+
+        Adopt(p, capacity);
+        ++size_;
+        return *res;
+    }
+
+    template <typename Construct>
+    void ResizeWith(size_type n, Construct&& construct) {
+        if (n <= size_) {
+            std::destroy(data_ + n, end());
+            size_ = n;
+            return;
+        }
+
+        if (n > capacity_) {
+            Reallocate(NextCapacity(n));
+        }
+
+        for (; size_ < n; ++size_) {
+            construct(data_ + size_);
+        }
+    }
+
+    alignas(T) unsigned char inline_[sizeof(T) * N];
+    T* data_{InlineData()};
+    size_type size_{0};
+    size_type capacity_{N};
+};
+
+}  // namespace lodash::container
+
+#endif  // LODASH_CONTAINER_SMALL_VECTOR_H
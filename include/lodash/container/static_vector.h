@@ -0,0 +1,161 @@
+#ifndef LODASH_CONTAINER_STATIC_VECTOR_H
+#define LODASH_CONTAINER_STATIC_VECTOR_H
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace lodash::container {
+
+// StaticVector is a vector of at most N elements stored inline in a std::array, so it never allocates and can be
+// built and read in constant expressions. It is the result of the algorithms which keep a subset of a std::array,
+// e.g. Filter, whose size is only bounded at compile time. T must be default constructible, the N elements are
+// constructed upfront. Growing it beyond N throws std::length_error.
+template <typename T, size_t N>
+class StaticVector {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr StaticVector() = default;
+
+    static constexpr size_type capacity() {
+        return N;
+    }
+
+    static constexpr size_type max_size() {
+        return N;
+    }
+
+    constexpr size_type size() const {
+        return size_;
+    }
+
+    constexpr bool empty() const {
+        return size_ == 0;
+    }
+
+    constexpr T* data() {
+        return data_.data();
+    }
+
+    constexpr const T* data() const {
+        return data_.data();
+    }
+
+    constexpr reference operator[](size_type ix) {
+        return data_[ix];
+    }
+
+    constexpr const_reference operator[](size_type ix) const {
+        return data_[ix];
+    }
+
+    constexpr reference front() {
+        return data_[0];
+    }
+
+    constexpr const_reference front() const {
+        return data_[0];
+    }
+
+    constexpr reference back() {
+        return data_[size_ - 1];
+    }
+
+    constexpr const_reference back() const {
+        return data_[size_ - 1];
+    }
+
+    constexpr iterator begin() {
+        return data();
+    }
+
+    constexpr const_iterator begin() const {
+        return data();
+    }
+
+    constexpr iterator end() {
+        return data() + size_;
+    }
+
+    constexpr const_iterator end() const {
+        return data() + size_;
+    }
+
+    constexpr const_iterator cbegin() const {
+        return begin();
+    }
+
+    constexpr const_iterator cend() const {
+        return end();
+    }
+
+    constexpr void push_back(const T& v) {
+        Grow(size_ + 1);
+        data_[size_++] = v;
+    }
+
+    constexpr void push_back(T&& v) {
+        Grow(size_ + 1);
+        data_[size_++] = std::move(v);
+    }
+
+    constexpr void pop_back() {
+        --size_;
+    }
+
+    // resize sets the size to n, the elements past the previous size are value-initialized as with std::vector.
+    constexpr void resize(size_type n) {
+        Grow(n);
+        for (auto i = size_; i < n; i++) {
+            data_[i] = T();
+        }
+
+        size_ = n;
+    }
+
+    constexpr void clear() {
+        size_ = 0;
+    }
+
+    friend constexpr bool operator==(const StaticVector& a, const StaticVector& b) {
+        if (a.size_ != b.size_) {
+            return false;
+        }
+
+        for (size_type i = 0; i < a.size_; i++) {
+            if (!(a.data_[i] == b.data_[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    friend constexpr bool operator!=(const StaticVector& a, const StaticVector& b) {
+        return !(a == b);
+    }
+
+private:
+    static constexpr void Grow(size_type n) {
+        if (n > N) {
+            throw std::length_error("StaticVector capacity exceeded");
+        }
+    }
+
+    std::array<T, N> data_{};
+    size_type size_{0};
+};
+
+}  // namespace lodash::container
+
+#endif  // LODASH_CONTAINER_STATIC_VECTOR_H
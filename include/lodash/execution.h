@@ -0,0 +1,67 @@
+#ifndef LODASH_EXECUTION_H
+#define LODASH_EXECUTION_H
+
+#include <cstddef>
+#include <type_traits>
+
+namespace lodash {
+
+class Executor;
+
+}  // namespace lodash
+
+namespace lodash::execution {
+
+// SequencedPolicy runs an algorithm on the calling thread, it is the same as calling the overload without policy.
+struct SequencedPolicy {};
+
+// ParallelPolicy splits a random-access input into chunks of at least `grain_size` elements and processes the
+// chunks concurrently. Inputs with no more than `grain_size` elements, or which are not random-access, are
+// processed sequentially.
+struct ParallelPolicy {
+    static constexpr size_t kDefaultGrainSize = 4096;
+
+    size_t grain_size{kDefaultGrainSize};
+
+    // max_concurrency limits the number of chunks an input is split into, 0 means the concurrency of the executor.
+    size_t max_concurrency{0};
+
+    // executor runs the chunks, nullptr means Executor::Default().
+    Executor* executor{nullptr};
+
+    constexpr ParallelPolicy WithGrainSize(size_t n) const {
+        auto p = *this;
+        p.grain_size = n > 0 ? n : 1;
+        return p;
+    }
+
+    constexpr ParallelPolicy WithMaxConcurrency(size_t n) const {
+        auto p = *this;
+        p.max_concurrency = n;
+        return p;
+    }
+
+    constexpr ParallelPolicy WithExecutor(Executor& e) const {
+        auto p = *this;
+        p.executor = &e;
+        return p;
+    }
+};
+
+inline constexpr SequencedPolicy seq{};
+inline constexpr ParallelPolicy par{};
+
+template <typename T>
+constexpr bool is_execution_policy_v =
+        std::is_same_v<std::decay_t<T>, SequencedPolicy> || std::is_same_v<std::decay_t<T>, ParallelPolicy>;
+
+}  // namespace lodash::execution
+
+namespace lodash {
+
+using execution::par;
+using execution::seq;
+
+}  // namespace lodash
+
+#endif  // LODASH_EXECUTION_H
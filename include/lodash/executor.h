@@ -0,0 +1,273 @@
+#ifndef LODASH_EXECUTOR_H
+#define LODASH_EXECUTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lodash {
+
+// Executor is a work-stealing thread pool which runs the parallel algorithms of lodash.
+//
+// Every worker owns a deque of tasks, it pops its own tasks LIFO and steals from the other deques FIFO when it runs
+// out of work. Threads which are not workers of the executor push to a shared injection deque. A thread waiting in
+// ParallelFor executes the pending tasks while there are any and otherwise sleeps like an idle worker until its call
+// completes, so nested and concurrent calls share the same workers and never oversubscribe the cores.
+class Executor {
+public:
+    using Task = std::function<void()>;
+
+    // worker_count is the number of background threads, the thread calling ParallelFor always participates as well.
+    explicit Executor(size_t worker_count = DefaultWorkerCount()) : queues_(worker_count + 1) {
+        for (auto& q : queues_) {
+            q = std::make_unique<TaskQueue>();
+        }
+
+        threads_.reserve(worker_count);
+        for (size_t i = 0; i < worker_count; i++) {
+            threads_.emplace_back([this, i] {
+                WorkerLoop(i);
+            });
+        }
+    }
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    ~Executor() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+
+        sleep_cv_.notify_all();
+
+        for (auto& t : threads_) {
+            t.join();
+        }
+    }
+
+    size_t WorkerCount() const {
+        return threads_.size();
+    }
+
+    // Concurrency is the number of threads which can execute tasks of a ParallelFor at the same time.
+    size_t Concurrency() const {
+        return threads_.size() + 1;
+    }
+
+    // Default returns the process-wide executor used when a policy doesn't name one.
+    static Executor& Default() {
+        static Executor executor;
+        return executor;
+    }
+
+    static size_t DefaultWorkerCount() {
+        return std::max<size_t>(std::thread::hardware_concurrency(), 1) - 1;
+    }
+
+    // ParallelFor invokes `f(ix)` for every ix in [0, n) and returns when all of them have finished.
+    // The range is split lazily: the running thread only hands off the upper half of its remaining range while some
+    // worker is idle, so an uncontended call runs sequentially without any task allocation.
+    // The first exception thrown by f is rethrown after all invocations have finished.
+    template <typename F>
+    void ParallelFor(size_t n, F&& f) {
+        if (n == 0) {
+            return;
+        }
+
+        if (n == 1 || threads_.empty()) {
+            for (size_t i = 0; i < n; i++) {
+                f(i);
+            }
+
+            return;
+        }
+
+        auto remaining = std::atomic<size_t>(n);
+        auto error_mutex = std::mutex();
+        auto error = std::exception_ptr();
+
+        auto run_range = [&](auto& self, size_t begin, size_t end) -> void {
+            while (begin < end) {
+                if (end - begin > 1 && idle_count_.load(std::memory_order_relaxed) > 0) {
+                    auto mid = begin + (end - begin) / 2;
+                    Push([&self, mid, end] {
+                        self(self, mid, end);
+                    });
+                    end = mid;
+                }
+
+                try {
+                    f(begin);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+
+                ++begin;
+
+                // The caller may return as soon as remaining is 0, destroying this closure and the state of the call,
+                // so only the executor, read beforehand, is used past the decrement. Taking the lock orders the
+                // wake-up after the check of remaining by a caller going to sleep.
+                auto* executor = this;
+                if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    {
+                        std::lock_guard<std::mutex> lock(executor->sleep_mutex_);
+                    }
+
+                    executor->sleep_cv_.notify_all();
+                }
+            }
+        };
+
+        run_range(run_range, 0, n);
+
+        // The caller helps with the pending tasks, its own or not, and sleeps when there are none. It counts as idle
+        // while asleep, so that the running chunks keep handing off work, which wakes it up.
+        while (remaining.load(std::memory_order_acquire) > 0) {
+            if (TryRunOne(GetQueueIndex())) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            idle_count_.fetch_add(1, std::memory_order_relaxed);
+            sleep_cv_.wait(lock, [this, &remaining] {
+                return remaining.load(std::memory_order_acquire) == 0 ||
+                       pending_count_.load(std::memory_order_acquire) > 0;
+            });
+            idle_count_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    size_t GetQueueIndex() const {
+        if (current_executor_ == this) {
+            return current_worker_;
+        }
+
+        return threads_.size();
+    }
+
+    void Push(Task&& task) {
+        auto& q = *queues_[GetQueueIndex()];
+
+        {
+            std::lock_guard<std::mutex> lock(q.mutex);
+            q.tasks.push_back(std::move(task));
+        }
+
+        pending_count_.fetch_add(1, std::memory_order_release);
+
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+        }
+
+        sleep_cv_.notify_one();
+    }
+
+    bool TryPop(size_t ix, Task& task) {
+        auto& q = *queues_[ix];
+        std::lock_guard<std::mutex> lock(q.mutex);
+
+        if (q.tasks.empty()) {
+            return false;
+        }
+
+        task = std::move(q.tasks.back());
+        q.tasks.pop_back();
+        pending_count_.fetch_sub(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    bool TrySteal(size_t ix, Task& task) {
+        auto& q = *queues_[ix];
+        std::lock_guard<std::mutex> lock(q.mutex);
+
+        if (q.tasks.empty()) {
+            return false;
+        }
+
+        task = std::move(q.tasks.front());
+        q.tasks.pop_front();
+        pending_count_.fetch_sub(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    // TryRunOne runs one task, taken from the own queue first and stolen from the others otherwise.
+    bool TryRunOne(size_t self_ix) {
+        auto task = Task();
+        auto found = TryPop(self_ix, task);
+
+        for (size_t i = 1; !found && i < queues_.size(); i++) {
+            found = TrySteal((self_ix + i) % queues_.size(), task);
+        }
+
+        if (found) {
+            task();
+        }
+
+        return found;
+    }
+
+    void WorkerLoop(size_t ix) {
+        current_executor_ = this;
+        current_worker_ = ix;
+
+        while (true) {
+            if (TryRunOne(ix)) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            idle_count_.fetch_add(1, std::memory_order_relaxed);
+            sleep_cv_.wait(lock, [this] {
+                return stop_ || pending_count_.load(std::memory_order_acquire) > 0;
+            });
+            idle_count_.fetch_sub(1, std::memory_order_relaxed);
+
+            if (stop_) {
+                return;
+            }
+        }
+    }
+
+private:
+    static inline thread_local const Executor* current_executor_ = nullptr;
+    static inline thread_local size_t current_worker_ = 0;
+
+    // queues_[i] is owned by the i-th worker, the last one is shared by the threads outside of the executor.
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::vector<std::thread> threads_;
+
+    std::atomic<size_t> pending_count_{0};
+    std::atomic<size_t> idle_count_{0};
+
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    bool stop_{false};
+};
+
+}  // namespace lodash
+
+#endif  // LODASH_EXECUTOR_H
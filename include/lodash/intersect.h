@@ -1,42 +1,106 @@
 #ifndef LODASH_INTERSECT_H
 #define LODASH_INTERSECT_H
 
+#include <functional>
 #include <iterator>
-#include <set>
+#include <optional>
 #include <type_traits>
-
+#include <utility>
+
+#include "./stats.h"
+#include "./type_check/is_random_access.h"
+#include "./type_check/is_std_array.h"
+#include "./type_utility/gallop_lower_bound.h"
+#include "./type_utility/forward_element.h"
+#include "./type_utility/get_size_hint.h"
+#include "./type_utility/is_constant_evaluated.h"
+#include "./type_utility/memory_resource.h"
 #include "./type_utility/push_back_to_container.h"
+#include "./type_utility/recycle.h"
+#include "./type_utility/retain_if.h"
+#include "./type_utility/unique_set.h"
 #include "./type_utility/visit_container.h"
 
 namespace lodash {
 
-// Contains returns true if an element is present in a collection.
+namespace type_utility {
+
+// AnyOf returns whether f returns truthy for an element of the container, it stops at the first one. It can be
+// evaluated at compile time, e.g. over a std::array.
 template <typename Container, typename F>
-inline bool ContainsBy(Container&& c, F&& f) {
+constexpr bool AnyOf(Container&& c, F&& f) {
     bool ok = false;
 
-    type_utility::VisitContainer(std::forward<Container>(c),
-                                 std::forward<F>(f),
-                                 [&ok](auto&& r, [[maybe_unused]] auto&& value, [[maybe_unused]] auto&& node_info) {
-                                     ok = r;
-                                     return type_utility::ReturnInfo{.need_exit = ok};
-                                 });
+    VisitContainer(std::forward<Container>(c),
+                   std::forward<F>(f),
+                   [&ok](auto&& r, [[maybe_unused]] auto&& value, [[maybe_unused]] auto&& node_info) {
+                       ok = r;
+                       return ReturnInfo{.need_exit = ok};
+                   });
+
+    return ok;
+}
+
+}  // namespace type_utility
+
+namespace intersect_internal {
+
+// ContainsBy and Contains are the run time implementations of lodash::ContainsBy and lodash::Contains.
+template <typename Container, typename F>
+inline bool ContainsBy(Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kContainsBy);
+
+    bool ok = type_utility::AnyOf(std::forward<Container>(c), std::forward<F>(f));
+    if (ok) {
+        recorder.EarlyExit();
+    }
 
     return ok;
 }
 
-// ContainsBy returns true if predicate function return true.
 template <typename Container, typename T>
 inline bool Contains(Container&& c, T&& t) {
+    auto recorder = stats::Recorder(stats::Algorithm::kContains);
+
     return ContainsBy(std::forward<Container>(c), [&t](auto&& value) {
         return value == t;
     });
 }
 
+}  // namespace intersect_internal
+
+// Contains returns true if an element is present in a collection.
+// A std::array can be searched in a constant expression.
+template <typename Container, typename F>
+constexpr bool ContainsBy(Container&& c, F&& f) {
+    if constexpr (type_check::is_std_array<std::decay_t<Container>>) {
+        if (type_utility::IsConstantEvaluated()) {
+            return type_utility::AnyOf(c, f);
+        }
+    }
+
+    return intersect_internal::ContainsBy(std::forward<Container>(c), std::forward<F>(f));
+}
+
+// ContainsBy returns true if predicate function return true.
+template <typename Container, typename T>
+constexpr bool Contains(Container&& c, T&& t) {
+    if constexpr (type_check::is_std_array<std::decay_t<Container>>) {
+        if (type_utility::IsConstantEvaluated()) {
+            return type_utility::AnyOf(c, [&t](auto&& value) {
+                return value == t;
+            });
+        }
+    }
+
+    return intersect_internal::Contains(std::forward<Container>(c), std::forward<T>(t));
+}
+
 // EveryBy returns true if the predicate returns true for all of the elements in the collection or if the collection is
 // empty.
 template <typename Container, typename F>
 inline bool EveryBy(Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kEveryBy);
     bool ok = true;
 
     type_utility::VisitContainer(std::forward<Container>(c),
@@ -46,12 +110,18 @@ inline bool EveryBy(Container&& c, F&& f) {
                                      return type_utility::ReturnInfo{.need_exit = !ok};
                                  });
 
+    if (!ok) {
+        recorder.EarlyExit();
+    }
+
     return ok;
 }
 
 // Every returns true if all elements of a subset are contained into a collection or if the subset is empty.
 template <typename Container>
 inline bool Every(Container&& c) {
+    auto recorder = stats::Recorder(stats::Algorithm::kEvery);
+
     return EveryBy(std::forward<Container>(c), [](auto&& x) {
         return static_cast<bool>(x);
     });
@@ -61,6 +131,7 @@ inline bool Every(Container&& c) {
 // If the collection is empty SomeBy returns false.
 template <typename Container, typename F>
 inline bool SomeBy(Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kSomeBy);
     bool ok = false;
 
     type_utility::VisitContainer(std::forward<Container>(c),
@@ -70,6 +141,10 @@ inline bool SomeBy(Container&& c, F&& f) {
                                      return type_utility::ReturnInfo{.need_exit = ok};
                                  });
 
+    if (ok) {
+        recorder.EarlyExit();
+    }
+
     return ok;
 }
 
@@ -77,6 +152,8 @@ inline bool SomeBy(Container&& c, F&& f) {
 // If the subset is empty Some returns false.
 template <typename Container>
 inline bool Some(Container&& c) {
+    auto recorder = stats::Recorder(stats::Algorithm::kSome);
+
     return SomeBy(std::forward<Container>(c), [](auto&& x) {
         return static_cast<bool>(x);
     });
@@ -86,6 +163,7 @@ inline bool Some(Container&& c) {
 // empty.
 template <typename Container, typename F>
 inline bool NoneBy(Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kNoneBy);
     bool ok = true;
 
     type_utility::VisitContainer(std::forward<Container>(c),
@@ -95,63 +173,307 @@ inline bool NoneBy(Container&& c, F&& f) {
                                      return type_utility::ReturnInfo{.need_exit = !ok};
                                  });
 
+    if (!ok) {
+        recorder.EarlyExit();
+    }
+
     return ok;
 }
 
 // None returns true if no element of a subset are contained into a collection or if the subset is empty.
 template <typename Container>
 inline bool None(Container&& c) {
+    auto recorder = stats::Recorder(stats::Algorithm::kNone);
+
     return NoneBy(std::forward<Container>(c), [](auto&& x) {
         return static_cast<bool>(x);
     });
 }
 
 // Intersect returns the intersection between two collections.
-template <typename Container>
-inline auto Intersect(Container&& c1, Container&& c2) {
+// Called with a `std::pmr::memory_resource*`, both the result and the scratch set allocate from it.
+// For rvalue inputs the elements of c1 are moved into the scratch set and c2 is filtered in place and returned.
+// `Intersect<R>` builds an R, e.g. a container::SmallVector which keeps a short result inline.
+template <typename R,
+          typename Resource,
+          typename Container,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Intersect(Resource resource, Container&& c1, Container&& c2) {
     using value_type = typename std::decay_t<Container>::value_type;
 
-    auto res = std::decay_t<Container>();
-    auto se = std::set<value_type>();
+    auto se = type_utility::MakeUniqueSet<value_type>(type_utility::GetSizeHint(c1), resource);
+    auto recorder = stats::Recorder(stats::Algorithm::kIntersect);
 
     for (auto&& v : c1) {
-        se.insert(v);
+        se.insert(type_utility::ForwardElement<Container>(v));
+    }
+
+    recorder.VisitAll(c1);
+    recorder.AddScratch(se);
+
+    if constexpr (type_utility::is_recyclable_v<R, Container>) {
+        if (type_utility::CanRecycle(c2, resource)) {
+            auto is_common = [&se](const value_type& v) {
+                return se.erase(v) > 0;
+            };
+
+            type_utility::RetainIf(c2, is_common, true);
+            recorder.SetResult(c2);
+            return R(std::move(c2));
+        }
     }
 
+    auto res = type_utility::MakeContainer<R>(resource);
     for (auto&& v : c2) {
-        if (se.count(v)) {
-            type_utility::PushBackToContainer(res, v);
-            se.erase(v);
+        if (se.erase(v)) {
+            type_utility::PushBackToContainer(res, type_utility::ForwardElement<Container>(v));
         }
     }
 
+    recorder.VisitAll(c2);
+    recorder.SetResult(res);
     return res;
 }
 
+template <typename Resource,
+          typename Container,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Intersect(Resource resource, Container&& c1, Container&& c2) {
+    using R = type_utility::rebind_container_t<std::decay_t<Container>, Resource>;
+    return Intersect<R>(resource, std::forward<Container>(c1), std::forward<Container>(c2));
+}
+
+template <typename R = void, typename Container>
+inline auto Intersect(Container&& c1, Container&& c2) {
+    if constexpr (std::is_void_v<R>) {
+        return Intersect(type_utility::DefaultResource{}, std::forward<Container>(c1), std::forward<Container>(c2));
+    } else {
+        return Intersect<R>(type_utility::DefaultResource{}, std::forward<Container>(c1), std::forward<Container>(c2));
+    }
+}
+
 // Union returns all distinct elements from both collections.
-// result returns will not change the order of elements relatively.
+// result returns will not change the order of elements relatively, i.e. elements are kept in the order of their first
+// occurrence in c1 followed by c2.
+// For rvalue inputs the result is built in the storage of c1 and the elements of c2 are moved into it.
+template <typename Resource,
+          typename Container,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Union(Resource resource, Container&& c1, Container&& c2) {
+    using value_type = typename std::decay_t<Container>::value_type;
+    using R = type_utility::rebind_container_t<std::decay_t<Container>, Resource>;
+
+    auto se = type_utility::MakeUniqueSet<value_type>(
+            type_utility::GetSizeHint(c1) + type_utility::GetSizeHint(c2), resource);
+    auto recorder = stats::Recorder(stats::Algorithm::kUnion);
+
+    if constexpr (type_utility::is_recyclable_v<R, Container>) {
+        if (type_utility::CanRecycle(c1, resource)) {
+            auto is_first = [&se](const value_type& v) {
+                return se.insert(v).second;
+            };
+
+            type_utility::RetainIf(c1, is_first, true);
+            for (auto&& v : c2) {
+                if (se.insert(v).second) {
+                    type_utility::PushBackToContainer(c1, std::move(v));
+                }
+            }
+
+            recorder.VisitAll(c2);
+            recorder.AddScratch(se);
+            recorder.SetResult(c1);
+            return R(std::move(c1));
+        }
+    }
+
+    auto res = type_utility::MakeContainer<R>(resource);
+    for (auto&& v : c1) {
+        if (se.insert(v).second) {
+            type_utility::PushBackToContainer(res, type_utility::ForwardElement<Container>(v));
+        }
+    }
+
+    for (auto&& v : c2) {
+        if (se.insert(v).second) {
+            type_utility::PushBackToContainer(res, type_utility::ForwardElement<Container>(v));
+        }
+    }
+
+    recorder.VisitAll(c1);
+    recorder.VisitAll(c2);
+    recorder.AddScratch(se);
+    recorder.SetResult(res);
+    return res;
+}
+
 template <typename Container>
 inline auto Union(Container&& c1, Container&& c2) {
+    return Union(type_utility::DefaultResource{}, std::forward<Container>(c1), std::forward<Container>(c2));
+}
+
+namespace type_utility {
+
+// kGallopRatio is the size ratio of two sorted inputs above which IntersectSorted gallops through the larger input
+// instead of merging both linearly.
+inline constexpr size_t kGallopRatio = 8;
+
+// last_element_t remembers the last element the sorted merges pushed, which skips the duplicates: it points to the
+// source element, or holds a copy of it if the iterators of Container compute their elements and return them by value.
+template <typename Container, typename T = typename std::decay_t<Container>::value_type>
+using last_element_t = std::conditional_t<
+        std::is_reference_v<typename std::iterator_traits<decltype(std::begin(std::declval<Container&>()))>::reference>,
+        const T*,
+        std::optional<T>>;
+
+template <typename T>
+inline void SetLastElement(const T*& last, const T& v) {
+    last = &v;
+}
+
+template <typename T>
+inline void SetLastElement(std::optional<T>& last, const T& v) {
+    last = v;
+}
+
+}  // namespace type_utility
+
+// IntersectSorted returns the intersection between two collections sorted by comp, each common element is returned
+// once and the result is sorted.
+// It merges both collections linearly without any auxiliary set. If both are random-access and one is much smaller
+// than the other, it walks the smaller one and gallops through the larger one, which costs O(m log(n / m))
+// comparisons for sizes m <= n.
+template <typename Resource,
+          typename Container,
+          typename Compare = std::less<>,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto IntersectSorted(Resource resource, Container&& c1, Container&& c2, Compare comp = Compare()) {
     using value_type = typename std::decay_t<Container>::value_type;
+    using R = type_utility::rebind_container_t<std::decay_t<Container>, Resource>;
 
-    auto res = std::decay_t<Container>();
-    auto se = std::set<value_type>();
+    auto recorder = stats::Recorder(stats::Algorithm::kIntersectSorted);
+    auto res = type_utility::MakeContainer<R>(resource);
 
-    for (auto&& v : c1) {
-        se.insert(v);
+    auto first1 = std::begin(c1);
+    auto last1 = std::end(c1);
+    auto first2 = std::begin(c2);
+    auto last2 = std::end(c2);
+
+    auto last_pushed = type_utility::last_element_t<Container>();
+    auto push = [&res, &last_pushed, &comp](const value_type& v) {
+        if (!last_pushed || comp(*last_pushed, v)) {
+            type_utility::PushBackToContainer(res, v);
+            type_utility::SetLastElement(last_pushed, v);
+        }
+    };
+
+    if constexpr (type_check::is_random_access<std::decay_t<Container>>) {
+        if (last1 - first1 > last2 - first2) {
+            std::swap(first1, first2);
+            std::swap(last1, last2);
+        }
+
+        if (first1 != last1 && static_cast<size_t>(last2 - first2) / static_cast<size_t>(last1 - first1) >=
+                                       type_utility::kGallopRatio) {
+            size_t visited = 0;
+            for (; first1 != last1 && first2 != last2; ++first1, ++visited) {
+                first2 = type_utility::GallopLowerBound(first2, last2, *first1, comp);
+                if (first2 != last2 && !comp(*first1, *first2)) {
+                    push(*first1);
+                }
+            }
+
+            recorder.AddVisits(visited);
+            recorder.SetResult(res);
+            return res;
+        }
     }
 
-    for (auto&& v : c2) {
-        se.insert(v);
+    size_t visited = 0;
+    while (first1 != last1 && first2 != last2) {
+        if (comp(*first1, *first2)) {
+            ++first1;
+            ++visited;
+        } else if (comp(*first2, *first1)) {
+            ++first2;
+            ++visited;
+        } else {
+            push(*first1);
+            ++first1;
+            ++first2;
+            visited += 2;
+        }
+    }
+
+    recorder.AddVisits(visited);
+    recorder.SetResult(res);
+    return res;
+}
+
+template <typename Container, typename Compare = std::less<>>
+inline auto IntersectSorted(Container&& c1, Container&& c2, Compare comp = Compare()) {
+    return IntersectSorted(
+            type_utility::DefaultResource{}, std::forward<Container>(c1), std::forward<Container>(c2), comp);
+}
+
+// UnionSorted returns all distinct elements from two collections sorted by comp, the result is sorted.
+// It merges both collections linearly without any auxiliary set.
+template <typename Resource,
+          typename Container,
+          typename Compare = std::less<>,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto UnionSorted(Resource resource, Container&& c1, Container&& c2, Compare comp = Compare()) {
+    using value_type = typename std::decay_t<Container>::value_type;
+    using R = type_utility::rebind_container_t<std::decay_t<Container>, Resource>;
+
+    auto res = type_utility::MakeContainer<R>(resource);
+    auto recorder = stats::Recorder(stats::Algorithm::kUnionSorted);
+
+    auto first1 = std::begin(c1);
+    auto last1 = std::end(c1);
+    auto first2 = std::begin(c2);
+    auto last2 = std::end(c2);
+
+    auto last_pushed = type_utility::last_element_t<Container>();
+    auto push = [&res, &last_pushed, &comp](const value_type& v) {
+        if (!last_pushed || comp(*last_pushed, v)) {
+            type_utility::PushBackToContainer(res, v);
+            type_utility::SetLastElement(last_pushed, v);
+        }
+    };
+
+    while (first1 != last1 && first2 != last2) {
+        if (comp(*first2, *first1)) {
+            push(*first2++);
+        } else {
+            if (!comp(*first1, *first2)) {
+                ++first2;
+            }
+
+            push(*first1++);
+        }
     }
 
-    for (auto&& v : se) {
-        type_utility::PushBackToContainer(res, v);
+    for (; first1 != last1; ++first1) {
+        push(*first1);
     }
 
+    for (; first2 != last2; ++first2) {
+        push(*first2);
+    }
+
+    recorder.VisitAll(c1);
+    recorder.VisitAll(c2);
+    recorder.SetResult(res);
     return res;
 }
 
+template <typename Container, typename Compare = std::less<>>
+inline auto UnionSorted(Container&& c1, Container&& c2, Compare comp = Compare()) {
+    return UnionSorted(
+            type_utility::DefaultResource{}, std::forward<Container>(c1), std::forward<Container>(c2), comp);
+}
+
 }  // namespace lodash
 
 #endif  // LODASH_INTERSECT_H
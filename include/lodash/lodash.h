@@ -1,9 +1,15 @@
 #ifndef LODASH_LODASH_H
 #define LODASH_LODASH_H
 
+#include "./chain.h"              // IWYU pragma: export
+#include "./execution.h"          // IWYU pragma: export
+#include "./executor.h"           // IWYU pragma: export
 #include "./intersect.h"          // IWYU pragma: export
 #include "./math.h"               // IWYU pragma: export
+#include "./predicate.h"          // IWYU pragma: export
 #include "./slice.h"              // IWYU pragma: export
+#include "./stats.h"              // IWYU pragma: export
+#include "./stream.h"             // IWYU pragma: export
 #include "./type_manipulation.h"  // IWYU pragma: export
 
 #endif  // LODASH_LODASH_H
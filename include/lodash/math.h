@@ -1,61 +1,117 @@
 #ifndef LODASH_MATH_H
 #define LODASH_MATH_H
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "./container/iota_range.h"
+#include "./execution.h"
+#include "./simd/iota.h"
+#include "./simd/sum.h"
+#include "./stats.h"
+#include "./type_check/is_contiguous.h"
+#include "./type_check/is_random_access.h"
+#include "./type_check/is_std_array.h"
+#include "./type_utility/accumulate.h"
+#include "./type_utility/iota.h"
+#include "./type_utility/is_constant_evaluated.h"
+#include "./type_utility/memory_resource.h"
+#include "./type_utility/parallel_for.h"
+
 namespace lodash {
 
-// Range creates an array of numbers (positive and/or negative) with given length.
-template <typename T = int32_t>
-inline auto Range(T start, T stop, T step) {
-    auto res = std::vector<T>();
-    res.reserve(abs(stop - start) / abs(step));
+// Range creates an array of numbers (positive and/or negative) from start up to, but not including, stop by step. It is
+// empty if step is 0 or steps away from stop. The integers are written by a vector kernel, see simd::Iota.
+// Called with a `std::pmr::memory_resource*`, the result is a std::pmr::vector allocating from it.
+template <typename T = int32_t,
+          typename Resource,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Range(Resource resource, T start, T stop, T step) {
+    using R = type_utility::rebind_container_t<std::vector<T>, Resource>;
+    auto res = type_utility::MakeContainer<R>(resource);
+    auto recorder = stats::Recorder(stats::Algorithm::kRange);
 
-    if (start == stop || step == 0) {
-        return res;
-    }
+    auto n = type_utility::IotaSize(start, stop, step);
+    res.resize(n);
+    simd::Iota(res.data(), n, start, step);
 
-    if (start < stop) {
-        if (step < 0) {
-            return res;
-        }
+    recorder.SetResult(res);
+    return res;
+}
 
-        for (auto i = start; i < stop; i += step) {
-            res.push_back(i);
-        }
+template <typename T = int32_t,
+          typename Resource,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Range(Resource resource, T start, T stop) {
+    if (start <= stop) {
+        return Range<T>(resource, start, stop, T(1));
+    } else {
+        return Range<T>(resource, start, stop, T(-1));
     }
+}
 
-    if (start > stop) {
-        if (step > 0) {
-            return res;
-        }
-
-        for (auto i = start; i > stop; i += step) {
-            res.push_back(i);
-        }
-    }
+template <typename T = int32_t,
+          typename Resource,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Range(Resource resource, T stop) {
+    return Range<T>(resource, T(0), stop);
+}
 
-    return res;
+template <typename T = int32_t>
+inline auto Range(T start, T stop, T step) {
+    return Range<T>(type_utility::DefaultResource{}, start, stop, step);
 }
 
 template <typename T = int32_t>
 inline auto Range(T start, T stop) {
+    return Range<T>(type_utility::DefaultResource{}, start, stop);
+}
+
+template <typename T = int32_t>
+inline auto Range(T stop) {
+    return Range<T>(type_utility::DefaultResource{}, stop);
+}
+
+// RangeView returns the numbers Range would create as a random access range which computes them as they are read
+// instead of storing them, so it neither allocates nor depends on the number of values. All the algorithms accept it,
+// those returning a container of the input type return a std::vector<T>.
+template <typename T = int32_t>
+constexpr auto RangeView(T start, T stop, T step) {
+    return container::IotaRange<T>(start, stop, step);
+}
+
+template <typename T = int32_t>
+constexpr auto RangeView(T start, T stop) {
     if (start <= stop) {
-        return Range<T>(start, stop, T(1));
+        return RangeView<T>(start, stop, T(1));
     } else {
-        return Range<T>(start, stop, T(-1));
+        return RangeView<T>(start, stop, T(-1));
     }
 }
 
 template <typename T = int32_t>
-inline auto Range(T stop) {
-    return Range<T>(T(0), stop);
+constexpr auto RangeView(T stop) {
+    return RangeView<T>(T(0), stop);
+}
+
+// RangeArray returns a std::array of the N numbers from start by step, which can be built at compile time, e.g. to
+// map it to a lookup table. The values are those of RangeView, see type_utility::IotaValue.
+template <size_t N, typename T = int32_t>
+constexpr auto RangeArray(T start = T(0), T step = T(1)) {
+    auto res = std::array<T, N>{};
+    for (size_t i = 0; i < N; i++) {
+        res[i] = type_utility::IotaValue(start, step, i);
+    }
+
+    return res;
 }
 
 // Clamp clamps number within the inclusive lower and upper bounds.
 template <typename T>
-inline auto Clamp(T&& t, T&& lower, T&& upper) {
+constexpr auto Clamp(T&& t, T&& lower, T&& upper) {
     if (t < lower) {
         return lower;
     }
@@ -67,28 +123,176 @@ inline auto Clamp(T&& t, T&& lower, T&& upper) {
     return t;
 }
 
-// Summarizes the values in a collection.
-template <typename Container>
+namespace type_utility {
+
+// use_simd_sum checks whether Sum / SumBy can run the kernels in simd/sum.h over the container.
+template <typename Container, typename value_type = typename std::decay_t<Container>::value_type>
+constexpr bool use_simd_sum = type_check::is_contiguous<std::decay_t<Container>> && std::is_arithmetic_v<value_type> &&
+                              !std::is_same_v<value_type, bool>;
+
+}  // namespace type_utility
+
+namespace math_internal {
+
+// Sum and SumBy are the run time implementations of lodash::Sum and lodash::SumBy.
+template <typename R, typename Container>
 inline auto Sum(Container&& c) {
-    auto res = typename std::decay_t<Container>::value_type();
+    using value_type = typename std::decay_t<Container>::value_type;
+    using result_type = std::conditional_t<std::is_void_v<R>, value_type, R>;
 
-    for (auto&& v : c) {
-        res += v;
+    auto recorder = stats::Recorder(stats::Algorithm::kSum);
+    recorder.VisitAll(c);
+
+    const auto identity = type_utility::Identity();
+    if constexpr (type_utility::use_simd_sum<Container> && std::is_same_v<result_type, value_type>) {
+        return simd::Sum(c.data(), c.size());
+    } else if constexpr (type_utility::use_simd_sum<Container>) {
+        return simd::SumBy<result_type>(c.data(), c.size(), identity);
+    } else {
+        return type_utility::Accumulate<result_type>(c, identity);
     }
+}
 
-    return res;
+template <typename R, typename Container, typename F>
+inline auto SumBy(Container&& c, F&& f) {
+    using result_type = type_utility::sum_result_t<R, Container, F>;
+    auto recorder = stats::Recorder(stats::Algorithm::kSumBy);
+    recorder.VisitAll(c);
+
+    if constexpr (type_utility::use_simd_sum<Container>) {
+        return simd::SumBy<result_type>(c.data(), c.size(), f);
+    } else {
+        return type_utility::Accumulate<result_type>(c, f);
+    }
+}
+
+}  // namespace math_internal
+
+// Summarizes the values in a collection.
+// Contiguous containers of arithmetic values are summarized by a vectorized kernel with independent accumulators, so
+// a floating-point result may differ from a left-to-right sum by rounding, see SumPairwise and SumKahan for accurate
+// floating-point sums. The values are accumulated into R, e.g. `Sum<int64_t>(c)` for a container of int32_t which
+// could overflow, R defaults to the value_type.
+// A std::array can be summarized in a constant expression, where its values are added from left to right.
+template <typename R = void, typename Container>
+constexpr auto Sum(Container&& c) {
+    if constexpr (type_check::is_std_array<std::decay_t<Container>>) {
+        if (type_utility::IsConstantEvaluated()) {
+            using result_type = std::conditional_t<std::is_void_v<R>, typename std::decay_t<Container>::value_type, R>;
+
+            const auto identity = type_utility::Identity();
+            return type_utility::Accumulate<result_type>(c, identity);
+        }
+    }
+
+    return math_internal::Sum<R>(std::forward<Container>(c));
 }
 
 // Summarizes the values in a collection by a custom function.
-template <typename Container, typename F>
-inline auto SumBy(Container&& c, F&& f) {
-    auto res = typename std::decay_t<Container>::value_type();
+// The results of f are accumulated into R, which defaults to the value_type of an arithmetic container and to the
+// result type of f otherwise. A std::array can be summarized in a constant expression as for Sum.
+template <typename R = void, typename Container, typename F>
+constexpr auto SumBy(Container&& c, F&& f) {
+    if constexpr (type_check::is_std_array<std::decay_t<Container>>) {
+        if (type_utility::IsConstantEvaluated()) {
+            return type_utility::Accumulate<type_utility::sum_result_t<R, Container, F>>(c, f);
+        }
+    }
+
+    return math_internal::SumBy<R>(std::forward<Container>(c), std::forward<F>(f));
+}
 
-    for (auto&& v : c) {
-        res += f(v);
+// SumBy with an execution policy. Under `par`, the chunks of a random-access input are summarized concurrently and the
+// partial sums are added in chunk order, so `f` must be safe to call from multiple threads.
+template <typename R = void,
+          typename Policy,
+          typename Container,
+          typename F,
+          std::enable_if_t<execution::is_execution_policy_v<Policy>, bool> = true>
+inline auto SumBy(Policy&& policy, Container&& c, F&& f) {
+    using result_type = type_utility::sum_result_t<R, Container, F>;
+    auto recorder = stats::Recorder(stats::Algorithm::kSumBy);
+
+    if constexpr (std::is_same_v<std::decay_t<Policy>, execution::ParallelPolicy> &&
+                  type_check::is_random_access<std::decay_t<Container>>) {
+        auto first = std::begin(c);
+        auto n = static_cast<size_t>(std::end(c) - first);
+        auto chunk_count = type_utility::GetChunkCount(policy, n);
+
+        if (chunk_count > 1) {
+            auto parts = std::vector<result_type>(chunk_count);
+
+            type_utility::ParallelForChunks(policy, chunk_count, n, [&](size_t chunk_ix, size_t begin, size_t end) {
+                if constexpr (type_utility::use_simd_sum<Container>) {
+                    parts[chunk_ix] = simd::SumBy<result_type>(c.data() + begin, end - begin, f);
+                } else {
+                    auto res = result_type();
+                    for (size_t i = begin; i < end; i++) {
+                        res += f(first[i]);
+                    }
+
+                    parts[chunk_ix] = res;
+                }
+            });
+
+            auto res = result_type();
+            for (auto&& part : parts) {
+                res += part;
+            }
+
+            recorder.AddVisits(n);
+            return res;
+        }
     }
 
-    return res;
+    return SumBy<result_type>(std::forward<Container>(c), std::forward<F>(f));
+}
+
+// SumPairwise summarizes the values in a collection with blocked pairwise summation: blocks of
+// type_utility::kPairwiseBlockSize values are summed by the vectorized kernel of Sum and the block sums are added in a
+// balanced tree. The rounding error grows with log(n) instead of n for a cost close to Sum's, and the result only
+// depends on the values and their order. The values are accumulated into R, which defaults to the value_type.
+template <typename R = void, typename Container>
+inline auto SumPairwise(Container&& c) {
+    using result_type = std::conditional_t<std::is_void_v<R>, typename std::decay_t<Container>::value_type, R>;
+    auto recorder = stats::Recorder(stats::Algorithm::kSumPairwise);
+    recorder.VisitAll(c);
+
+    const auto identity = type_utility::Identity();
+    return type_utility::AccumulatePairwise<result_type>(c, identity);
+}
+
+// SumPairwiseBy is SumPairwise over the results of f, accumulated into R as for SumBy.
+template <typename R = void, typename Container, typename F>
+inline auto SumPairwiseBy(Container&& c, F&& f) {
+    using result_type = type_utility::sum_result_t<R, Container, F>;
+    auto recorder = stats::Recorder(stats::Algorithm::kSumPairwiseBy);
+    recorder.VisitAll(c);
+
+    return type_utility::AccumulatePairwise<result_type>(c, f);
+}
+
+// SumKahan summarizes the values in a collection with compensated (Kahan-Neumaier) summation, which is accurate to a
+// few ulps whatever the number and the order of the values, but sequential and an order of magnitude slower than Sum.
+// R must be a floating-point type, it defaults to the value_type.
+template <typename R = void, typename Container>
+inline auto SumKahan(Container&& c) {
+    using result_type = std::conditional_t<std::is_void_v<R>, typename std::decay_t<Container>::value_type, R>;
+    auto recorder = stats::Recorder(stats::Algorithm::kSumKahan);
+    recorder.VisitAll(c);
+
+    const auto identity = type_utility::Identity();
+    return type_utility::AccumulateKahan<result_type>(c, identity);
+}
+
+// SumKahanBy is SumKahan over the results of f, accumulated into R as for SumBy.
+template <typename R = void, typename Container, typename F>
+inline auto SumKahanBy(Container&& c, F&& f) {
+    using result_type = type_utility::sum_result_t<R, Container, F>;
+    auto recorder = stats::Recorder(stats::Algorithm::kSumKahanBy);
+    recorder.VisitAll(c);
+
+    return type_utility::AccumulateKahan<result_type>(c, f);
 }
 
 }  // namespace lodash
@@ -0,0 +1,48 @@
+#ifndef LODASH_PREDICATE_H
+#define LODASH_PREDICATE_H
+
+#include "./type_utility/compare_predicate.h"
+
+namespace lodash {
+
+// Eq returns a predicate which checks whether a value is equal to v.
+// The comparison predicates can be passed to Filter, Reject and friends like any other predicate, on contiguous
+// arithmetic inputs they are evaluated with vector comparisons.
+template <typename T>
+inline constexpr auto Eq(T v) {
+    return type_utility::ComparePredicate<type_utility::CompareOp::kEq, T>{v};
+}
+
+// Ne returns a predicate which checks whether a value is not equal to v.
+template <typename T>
+inline constexpr auto Ne(T v) {
+    return type_utility::ComparePredicate<type_utility::CompareOp::kNe, T>{v};
+}
+
+// Lt returns a predicate which checks whether a value is less than v.
+template <typename T>
+inline constexpr auto Lt(T v) {
+    return type_utility::ComparePredicate<type_utility::CompareOp::kLt, T>{v};
+}
+
+// Lte returns a predicate which checks whether a value is less than or equal to v.
+template <typename T>
+inline constexpr auto Lte(T v) {
+    return type_utility::ComparePredicate<type_utility::CompareOp::kLte, T>{v};
+}
+
+// Gt returns a predicate which checks whether a value is greater than v.
+template <typename T>
+inline constexpr auto Gt(T v) {
+    return type_utility::ComparePredicate<type_utility::CompareOp::kGt, T>{v};
+}
+
+// Gte returns a predicate which checks whether a value is greater than or equal to v.
+template <typename T>
+inline constexpr auto Gte(T v) {
+    return type_utility::ComparePredicate<type_utility::CompareOp::kGte, T>{v};
+}
+
+}  // namespace lodash
+
+#endif  // LODASH_PREDICATE_H
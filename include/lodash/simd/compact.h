@@ -0,0 +1,395 @@
+#ifndef LODASH_SIMD_COMPACT_H
+#define LODASH_SIMD_COMPACT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../type_utility/compare_predicate.h"
+#include "./sum.h"
+
+namespace lodash::simd {
+
+using type_utility::CompareOp;
+
+// FloatCompareImm returns the predicate immediate of the floating point vector comparisons for op, the ordered
+// variants are used except for kNe, so that NaN compares the same as with the scalar operators.
+constexpr int FloatCompareImm(CompareOp op) {
+    switch (op) {
+        case CompareOp::kEq:
+            return 0x00;  // _CMP_EQ_OQ
+        case CompareOp::kNe:
+            return 0x04;  // _CMP_NEQ_UQ
+        case CompareOp::kLt:
+            return 0x11;  // _CMP_LT_OQ
+        case CompareOp::kLte:
+            return 0x12;  // _CMP_LE_OQ
+        case CompareOp::kGt:
+            return 0x1e;  // _CMP_GT_OQ
+        default:
+            return 0x1d;  // _CMP_GE_OQ
+    }
+}
+
+// CompactOps wraps the vector comparisons and the compress-store of the widest instruction set enabled at compile
+// time for one element type. The primary template is left empty and means "no vector kernel".
+// CompressStore writes a full vector at p, the selected lanes first, so p must have room for kWidth elements.
+template <typename T, typename = void>
+struct CompactOps {};
+
+template <typename T>
+constexpr bool is_signed_int32_v = is_int32_v<T> && std::is_signed_v<T>;
+
+template <typename T>
+constexpr bool is_signed_int64_v = is_int64_v<T> && std::is_signed_v<T>;
+
+#if defined(__AVX512F__)
+
+// IntCompareImm returns the predicate immediate of the AVX-512 integer comparisons for op.
+constexpr int IntCompareImm(CompareOp op) {
+    switch (op) {
+        case CompareOp::kEq:
+            return 0;  // _MM_CMPINT_EQ
+        case CompareOp::kNe:
+            return 4;  // _MM_CMPINT_NE
+        case CompareOp::kLt:
+            return 1;  // _MM_CMPINT_LT
+        case CompareOp::kLte:
+            return 2;  // _MM_CMPINT_LE
+        case CompareOp::kGt:
+            return 6;  // _MM_CMPINT_NLE
+        default:
+            return 5;  // _MM_CMPINT_NLT
+    }
+}
+
+template <typename T>
+struct CompactOps<T, std::enable_if_t<is_signed_int32_v<T>>> {
+    using vector_type = __m512i;
+    using mask_type = __mmask16;
+    static constexpr size_t kWidth = 16;
+
+    static vector_type Load(const T* p) {
+        return _mm512_loadu_si512(p);
+    }
+
+    static vector_type Set1(T v) {
+        return _mm512_set1_epi32(v);
+    }
+
+    template <CompareOp Op>
+    static mask_type Compare(vector_type a, vector_type b) {
+        return _mm512_cmp_epi32_mask(a, b, IntCompareImm(Op));
+    }
+
+    static void CompressStore(T* p, vector_type v, mask_type m) {
+        _mm512_storeu_si512(p, _mm512_maskz_compress_epi32(m, v));
+    }
+};
+
+template <typename T>
+struct CompactOps<T, std::enable_if_t<is_signed_int64_v<T>>> {
+    using vector_type = __m512i;
+    using mask_type = __mmask8;
+    static constexpr size_t kWidth = 8;
+
+    static vector_type Load(const T* p) {
+        return _mm512_loadu_si512(p);
+    }
+
+    static vector_type Set1(T v) {
+        return _mm512_set1_epi64(v);
+    }
+
+    template <CompareOp Op>
+    static mask_type Compare(vector_type a, vector_type b) {
+        return _mm512_cmp_epi64_mask(a, b, IntCompareImm(Op));
+    }
+
+    static void CompressStore(T* p, vector_type v, mask_type m) {
+        _mm512_storeu_si512(p, _mm512_maskz_compress_epi64(m, v));
+    }
+};
+
+template <>
+struct CompactOps<float> {
+    using vector_type = __m512;
+    using mask_type = __mmask16;
+    static constexpr size_t kWidth = 16;
+
+    static vector_type Load(const float* p) {
+        return _mm512_loadu_ps(p);
+    }
+
+    static vector_type Set1(float v) {
+        return _mm512_set1_ps(v);
+    }
+
+    template <CompareOp Op>
+    static mask_type Compare(vector_type a, vector_type b) {
+        return _mm512_cmp_ps_mask(a, b, FloatCompareImm(Op));
+    }
+
+    static void CompressStore(float* p, vector_type v, mask_type m) {
+        _mm512_storeu_ps(p, _mm512_maskz_compress_ps(m, v));
+    }
+};
+
+template <>
+struct CompactOps<double> {
+    using vector_type = __m512d;
+    using mask_type = __mmask8;
+    static constexpr size_t kWidth = 8;
+
+    static vector_type Load(const double* p) {
+        return _mm512_loadu_pd(p);
+    }
+
+    static vector_type Set1(double v) {
+        return _mm512_set1_pd(v);
+    }
+
+    template <CompareOp Op>
+    static mask_type Compare(vector_type a, vector_type b) {
+        return _mm512_cmp_pd_mask(a, b, FloatCompareImm(Op));
+    }
+
+    static void CompressStore(double* p, vector_type v, mask_type m) {
+        _mm512_storeu_pd(p, _mm512_maskz_compress_pd(m, v));
+    }
+};
+
+#elif defined(__AVX2__)
+
+// CompressTable holds, for every mask of kLanes lanes, the 32-bit source indices of _mm256_permutevar8x32 which move
+// the selected lanes to the front of the vector.
+template <size_t kLanes>
+struct CompressTable {
+    alignas(32) uint32_t indices[1 << kLanes][8];
+};
+
+template <size_t kLanes>
+constexpr CompressTable<kLanes> MakeCompressTable() {
+    constexpr size_t kWords = 8 / kLanes;
+    auto res = CompressTable<kLanes>{};
+
+    for (size_t m = 0; m < (size_t(1) << kLanes); m++) {
+        size_t k = 0;
+        for (size_t lane = 0; lane < kLanes; lane++) {
+            if ((m >> lane) & 1) {
+                for (size_t w = 0; w < kWords; w++) {
+                    res.indices[m][k * kWords + w] = static_cast<uint32_t>(lane * kWords + w);
+                }
+
+                ++k;
+            }
+        }
+    }
+
+    return res;
+}
+
+template <size_t kLanes>
+inline constexpr CompressTable<kLanes> kCompressTable = MakeCompressTable<kLanes>();
+
+template <size_t kLanes>
+inline __m256i LoadCompressIndices(uint32_t m) {
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(kCompressTable<kLanes>.indices[m]));
+}
+
+// IntCompare evaluates op from the equality and greater-than masks AVX2 provides, the other operators are their
+// complements.
+template <CompareOp Op, uint32_t kFullMask, typename Eq, typename Gt>
+inline uint32_t IntCompare(Eq eq, Gt gt) {
+    if constexpr (Op == CompareOp::kEq) {
+        return eq();
+    } else if constexpr (Op == CompareOp::kNe) {
+        return eq() ^ kFullMask;
+    } else if constexpr (Op == CompareOp::kLt) {
+        return gt(true);
+    } else if constexpr (Op == CompareOp::kLte) {
+        return gt(false) ^ kFullMask;
+    } else if constexpr (Op == CompareOp::kGt) {
+        return gt(false);
+    } else {
+        return gt(true) ^ kFullMask;
+    }
+}
+
+template <typename T>
+struct CompactOps<T, std::enable_if_t<is_signed_int32_v<T>>> {
+    using vector_type = __m256i;
+    using mask_type = uint32_t;
+    static constexpr size_t kWidth = 8;
+
+    static vector_type Load(const T* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    static vector_type Set1(T v) {
+        return _mm256_set1_epi32(v);
+    }
+
+    static mask_type MoveMask(vector_type v) {
+        return static_cast<mask_type>(_mm256_movemask_ps(_mm256_castsi256_ps(v)));
+    }
+
+    template <CompareOp Op>
+    static mask_type Compare(vector_type a, vector_type b) {
+        return IntCompare<Op, 0xFF>(
+                [&] {
+                    return MoveMask(_mm256_cmpeq_epi32(a, b));
+                },
+                [&](bool swap) {
+                    return MoveMask(swap ? _mm256_cmpgt_epi32(b, a) : _mm256_cmpgt_epi32(a, b));
+                });
+    }
+
+    static void CompressStore(T* p, vector_type v, mask_type m) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_permutevar8x32_epi32(v, LoadCompressIndices<8>(m)));
+    }
+};
+
+template <typename T>
+struct CompactOps<T, std::enable_if_t<is_signed_int64_v<T>>> {
+    using vector_type = __m256i;
+    using mask_type = uint32_t;
+    static constexpr size_t kWidth = 4;
+
+    static vector_type Load(const T* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    static vector_type Set1(T v) {
+        return _mm256_set1_epi64x(v);
+    }
+
+    static mask_type MoveMask(vector_type v) {
+        return static_cast<mask_type>(_mm256_movemask_pd(_mm256_castsi256_pd(v)));
+    }
+
+    template <CompareOp Op>
+    static mask_type Compare(vector_type a, vector_type b) {
+        return IntCompare<Op, 0xF>(
+                [&] {
+                    return MoveMask(_mm256_cmpeq_epi64(a, b));
+                },
+                [&](bool swap) {
+                    return MoveMask(swap ? _mm256_cmpgt_epi64(b, a) : _mm256_cmpgt_epi64(a, b));
+                });
+    }
+
+    static void CompressStore(T* p, vector_type v, mask_type m) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_permutevar8x32_epi32(v, LoadCompressIndices<4>(m)));
+    }
+};
+
+template <>
+struct CompactOps<float> {
+    using vector_type = __m256;
+    using mask_type = uint32_t;
+    static constexpr size_t kWidth = 8;
+
+    static vector_type Load(const float* p) {
+        return _mm256_loadu_ps(p);
+    }
+
+    static vector_type Set1(float v) {
+        return _mm256_set1_ps(v);
+    }
+
+    template <CompareOp Op>
+    static mask_type Compare(vector_type a, vector_type b) {
+        return static_cast<mask_type>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, FloatCompareImm(Op))));
+    }
+
+    static void CompressStore(float* p, vector_type v, mask_type m) {
+        _mm256_storeu_ps(p, _mm256_permutevar8x32_ps(v, LoadCompressIndices<8>(m)));
+    }
+};
+
+template <>
+struct CompactOps<double> {
+    using vector_type = __m256d;
+    using mask_type = uint32_t;
+    static constexpr size_t kWidth = 4;
+
+    static vector_type Load(const double* p) {
+        return _mm256_loadu_pd(p);
+    }
+
+    static vector_type Set1(double v) {
+        return _mm256_set1_pd(v);
+    }
+
+    template <CompareOp Op>
+    static mask_type Compare(vector_type a, vector_type b) {
+        return static_cast<mask_type>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, FloatCompareImm(Op))));
+    }
+
+    static void CompressStore(double* p, vector_type v, mask_type m) {
+        auto indices = LoadCompressIndices<4>(m);
+        _mm256_storeu_pd(p, _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(v), indices)));
+    }
+};
+
+#endif
+
+template <typename T, typename = void>
+constexpr bool has_compact_ops_v{};
+
+template <typename T>
+constexpr bool has_compact_ops_v<T, std::void_t<decltype(CompactOps<T>::kWidth)>> = true;
+
+// use_vector_compare_v checks whether a predicate of type F is a ComparePredicate which the vector kernel of T can
+// evaluate exactly, i.e. its value converts to T without changing the result of the comparison.
+template <typename T, typename F, typename = void>
+constexpr bool use_vector_compare_v{};
+
+template <typename T, typename F>
+constexpr bool use_vector_compare_v<T, F, std::enable_if_t<type_utility::is_compare_predicate_v<std::decay_t<F>>>> =
+        has_compact_ops_v<T> &&
+        (std::is_same_v<typename std::decay_t<F>::value_type, T> ||
+         (std::is_integral_v<T> && std::is_integral_v<typename std::decay_t<F>::value_type> &&
+          std::is_signed_v<typename std::decay_t<F>::value_type> &&
+          sizeof(typename std::decay_t<F>::value_type) <= sizeof(T)));
+
+// CompactBy copies the values of p[0, n) for which `bool(f(value)) == keep` to out, preserving their order, and
+// returns how many were copied. out must have room for n values and may be p itself.
+// Every value is written unconditionally and the output cursor advances by the predicate result, so the loop has no
+// data-dependent branch. ComparePredicate is evaluated kWidth values at a time with a compress-store when a vector
+// kernel is available.
+template <typename T, typename F>
+inline size_t CompactBy(const T* p, size_t n, T* out, F& f, bool keep) {
+    size_t i = 0;
+    size_t k = 0;
+
+    if constexpr (use_vector_compare_v<T, F>) {
+        using ops = CompactOps<T>;
+        using mask_type = typename ops::mask_type;
+        constexpr auto kOp = std::decay_t<F>::kOp;
+        constexpr auto kFullMask = static_cast<mask_type>((uint64_t(1) << ops::kWidth) - 1);
+
+        auto value = ops::Set1(static_cast<T>(f.value));
+        auto flip = keep ? mask_type(0) : kFullMask;
+
+        for (; i + ops::kWidth <= n; i += ops::kWidth) {
+            auto v = ops::Load(p + i);
+            auto m = static_cast<mask_type>(ops::template Compare<kOp>(v, value) ^ flip);
+            ops::CompressStore(out + k, v, m);
+            k += static_cast<size_t>(__builtin_popcount(m));
+        }
+    }
+
+    for (; i < n; i++) {
+        auto v = p[i];
+        out[k] = v;
+        k += static_cast<bool>(f(v)) == keep;
+    }
+
+    return k;
+}
+
+}  // namespace lodash::simd
+
+#endif  // LODASH_SIMD_COMPACT_H
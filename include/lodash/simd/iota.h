@@ -0,0 +1,50 @@
+#ifndef LODASH_SIMD_IOTA_H
+#define LODASH_SIMD_IOTA_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../type_utility/iota.h"
+#include "./sum.h"
+
+namespace lodash::simd {
+
+// Iota writes the n values of the range from start by step to p, see type_utility::IotaValue. The 32 and 64-bit
+// integers are written a vector at a time, each vector being the previous one plus kWidth steps, which wraps around
+// the same as IotaValue does.
+template <typename T>
+inline void Iota(T* p, size_t n, T start, T step) {
+    size_t i = 0;
+
+    if constexpr (has_vector_ops_v<T> && std::is_integral_v<T>) {
+        using ops = VectorOps<T>;
+
+        if (n >= ops::kWidth) {
+            const auto stride = type_utility::IotaValue(T(0), step, ops::kWidth);
+
+            T lanes[ops::kWidth];
+            T steps[ops::kWidth];
+            for (size_t k = 0; k < ops::kWidth; k++) {
+                lanes[k] = type_utility::IotaValue(start, step, k);
+                steps[k] = stride;
+            }
+
+            auto v = ops::Load(lanes);
+            const auto delta = ops::Load(steps);
+
+            const size_t vectorized = n - n % ops::kWidth;
+            for (; i < vectorized; i += ops::kWidth) {
+                ops::Store(p + i, v);
+                v = ops::Add(v, delta);
+            }
+        }
+    }
+
+    for (; i < n; i++) {
+        p[i] = type_utility::IotaValue(start, step, i);
+    }
+}
+
+}  // namespace lodash::simd
+
+#endif  // LODASH_SIMD_IOTA_H
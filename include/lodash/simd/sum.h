@@ -0,0 +1,484 @@
+#ifndef LODASH_SIMD_SUM_H
+#define LODASH_SIMD_SUM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX512F__) || defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace lodash::simd {
+
+// VectorOps wraps the vector instructions of the widest instruction set enabled at compile time for one element type.
+// The primary template is left empty and means "no vector kernel".
+template <typename T, typename = void>
+struct VectorOps {};
+
+template <typename T>
+constexpr bool is_int32_v = std::is_integral_v<T> && sizeof(T) == 4;
+
+template <typename T>
+constexpr bool is_int64_v = std::is_integral_v<T> && sizeof(T) == 8;
+
+#if defined(__AVX512F__)
+
+template <>
+struct VectorOps<double> {
+    using vector_type = __m512d;
+    static constexpr size_t kWidth = 8;
+
+    static vector_type Zero() {
+        return _mm512_setzero_pd();
+    }
+
+    static vector_type Load(const double* p) {
+        return _mm512_loadu_pd(p);
+    }
+
+    static void Store(double* p, vector_type a) {
+        _mm512_storeu_pd(p, a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm512_add_pd(a, b);
+    }
+
+    static double ReduceAdd(vector_type a) {
+        alignas(64) double lanes[kWidth];
+        _mm512_store_pd(lanes, a);
+
+        auto res = double();
+        for (size_t i = 0; i < kWidth; i++) {
+            res += lanes[i];
+        }
+
+        return res;
+    }
+};
+
+template <>
+struct VectorOps<float> {
+    using vector_type = __m512;
+    static constexpr size_t kWidth = 16;
+
+    static vector_type Zero() {
+        return _mm512_setzero_ps();
+    }
+
+    static vector_type Load(const float* p) {
+        return _mm512_loadu_ps(p);
+    }
+
+    static void Store(float* p, vector_type a) {
+        _mm512_storeu_ps(p, a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm512_add_ps(a, b);
+    }
+
+    static float ReduceAdd(vector_type a) {
+        alignas(64) float lanes[kWidth];
+        _mm512_store_ps(lanes, a);
+
+        auto res = float();
+        for (size_t i = 0; i < kWidth; i++) {
+            res += lanes[i];
+        }
+
+        return res;
+    }
+};
+
+template <typename T>
+struct VectorOps<T, std::enable_if_t<is_int32_v<T>>> {
+    using vector_type = __m512i;
+    static constexpr size_t kWidth = 16;
+
+    static vector_type Zero() {
+        return _mm512_setzero_si512();
+    }
+
+    static vector_type Load(const T* p) {
+        return _mm512_loadu_si512(p);
+    }
+
+    static void Store(T* p, vector_type a) {
+        _mm512_storeu_si512(p, a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm512_add_epi32(a, b);
+    }
+
+    static T ReduceAdd(vector_type a) {
+        alignas(64) T lanes[kWidth];
+        _mm512_store_si512(lanes, a);
+
+        auto res = T();
+        for (size_t i = 0; i < kWidth; i++) {
+            res += lanes[i];
+        }
+
+        return res;
+    }
+};
+
+template <typename T>
+struct VectorOps<T, std::enable_if_t<is_int64_v<T>>> {
+    using vector_type = __m512i;
+    static constexpr size_t kWidth = 8;
+
+    static vector_type Zero() {
+        return _mm512_setzero_si512();
+    }
+
+    static vector_type Load(const T* p) {
+        return _mm512_loadu_si512(p);
+    }
+
+    static void Store(T* p, vector_type a) {
+        _mm512_storeu_si512(p, a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm512_add_epi64(a, b);
+    }
+
+    static T ReduceAdd(vector_type a) {
+        alignas(64) T lanes[kWidth];
+        _mm512_store_si512(lanes, a);
+
+        auto res = T();
+        for (size_t i = 0; i < kWidth; i++) {
+            res += lanes[i];
+        }
+
+        return res;
+    }
+};
+
+#elif defined(__AVX2__)
+
+template <>
+struct VectorOps<double> {
+    using vector_type = __m256d;
+    static constexpr size_t kWidth = 4;
+
+    static vector_type Zero() {
+        return _mm256_setzero_pd();
+    }
+
+    static vector_type Load(const double* p) {
+        return _mm256_loadu_pd(p);
+    }
+
+    static void Store(double* p, vector_type a) {
+        _mm256_storeu_pd(p, a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm256_add_pd(a, b);
+    }
+
+    static double ReduceAdd(vector_type a) {
+        alignas(32) double lanes[kWidth];
+        _mm256_store_pd(lanes, a);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+template <>
+struct VectorOps<float> {
+    using vector_type = __m256;
+    static constexpr size_t kWidth = 8;
+
+    static vector_type Zero() {
+        return _mm256_setzero_ps();
+    }
+
+    static vector_type Load(const float* p) {
+        return _mm256_loadu_ps(p);
+    }
+
+    static void Store(float* p, vector_type a) {
+        _mm256_storeu_ps(p, a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm256_add_ps(a, b);
+    }
+
+    static float ReduceAdd(vector_type a) {
+        alignas(32) float lanes[kWidth];
+        _mm256_store_ps(lanes, a);
+        return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    }
+};
+
+template <typename T>
+struct VectorOps<T, std::enable_if_t<is_int32_v<T>>> {
+    using vector_type = __m256i;
+    static constexpr size_t kWidth = 8;
+
+    static vector_type Zero() {
+        return _mm256_setzero_si256();
+    }
+
+    static vector_type Load(const T* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    static void Store(T* p, vector_type a) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm256_add_epi32(a, b);
+    }
+
+    static T ReduceAdd(vector_type a) {
+        alignas(32) T lanes[kWidth];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+
+        auto res = T();
+        for (size_t i = 0; i < kWidth; i++) {
+            res += lanes[i];
+        }
+
+        return res;
+    }
+};
+
+template <typename T>
+struct VectorOps<T, std::enable_if_t<is_int64_v<T>>> {
+    using vector_type = __m256i;
+    static constexpr size_t kWidth = 4;
+
+    static vector_type Zero() {
+        return _mm256_setzero_si256();
+    }
+
+    static vector_type Load(const T* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    static void Store(T* p, vector_type a) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm256_add_epi64(a, b);
+    }
+
+    static T ReduceAdd(vector_type a) {
+        alignas(32) T lanes[kWidth];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+#elif defined(__SSE2__)
+
+template <>
+struct VectorOps<double> {
+    using vector_type = __m128d;
+    static constexpr size_t kWidth = 2;
+
+    static vector_type Zero() {
+        return _mm_setzero_pd();
+    }
+
+    static vector_type Load(const double* p) {
+        return _mm_loadu_pd(p);
+    }
+
+    static void Store(double* p, vector_type a) {
+        _mm_storeu_pd(p, a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm_add_pd(a, b);
+    }
+
+    static double ReduceAdd(vector_type a) {
+        alignas(16) double lanes[kWidth];
+        _mm_store_pd(lanes, a);
+        return lanes[0] + lanes[1];
+    }
+};
+
+template <>
+struct VectorOps<float> {
+    using vector_type = __m128;
+    static constexpr size_t kWidth = 4;
+
+    static vector_type Zero() {
+        return _mm_setzero_ps();
+    }
+
+    static vector_type Load(const float* p) {
+        return _mm_loadu_ps(p);
+    }
+
+    static void Store(float* p, vector_type a) {
+        _mm_storeu_ps(p, a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm_add_ps(a, b);
+    }
+
+    static float ReduceAdd(vector_type a) {
+        alignas(16) float lanes[kWidth];
+        _mm_store_ps(lanes, a);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+template <typename T>
+struct VectorOps<T, std::enable_if_t<is_int32_v<T>>> {
+    using vector_type = __m128i;
+    static constexpr size_t kWidth = 4;
+
+    static vector_type Zero() {
+        return _mm_setzero_si128();
+    }
+
+    static vector_type Load(const T* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+
+    static void Store(T* p, vector_type a) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm_add_epi32(a, b);
+    }
+
+    static T ReduceAdd(vector_type a) {
+        alignas(16) T lanes[kWidth];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), a);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+template <typename T>
+struct VectorOps<T, std::enable_if_t<is_int64_v<T>>> {
+    using vector_type = __m128i;
+    static constexpr size_t kWidth = 2;
+
+    static vector_type Zero() {
+        return _mm_setzero_si128();
+    }
+
+    static vector_type Load(const T* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+
+    static void Store(T* p, vector_type a) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a);
+    }
+
+    static vector_type Add(vector_type a, vector_type b) {
+        return _mm_add_epi64(a, b);
+    }
+
+    static T ReduceAdd(vector_type a) {
+        alignas(16) T lanes[kWidth];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), a);
+        return lanes[0] + lanes[1];
+    }
+};
+
+#endif
+
+template <typename T, typename = void>
+constexpr bool has_vector_ops_v{};
+
+template <typename T>
+constexpr bool has_vector_ops_v<T, std::void_t<decltype(VectorOps<T>::kWidth)>> = true;
+
+// kAccumulatorCount is the number of independent accumulators used by the kernels, which hides the latency of the
+// add instruction behind the loop-carried dependency.
+inline constexpr size_t kAccumulatorCount = 4;
+
+// Sum adds up n arithmetic values stored contiguously.
+// The values with VectorOps are accumulated in kAccumulatorCount independent vector accumulators, so for floating point
+// the result may differ from a left-to-right sum by rounding.
+template <typename T>
+inline T Sum(const T* p, size_t n) {
+    size_t i = 0;
+    auto res = T();
+
+    if constexpr (has_vector_ops_v<T>) {
+        using ops = VectorOps<T>;
+        constexpr size_t kStep = ops::kWidth * kAccumulatorCount;
+
+        auto a0 = ops::Zero();
+        auto a1 = ops::Zero();
+        auto a2 = ops::Zero();
+        auto a3 = ops::Zero();
+
+        for (; i + kStep <= n; i += kStep) {
+            a0 = ops::Add(a0, ops::Load(p + i));
+            a1 = ops::Add(a1, ops::Load(p + i + ops::kWidth));
+            a2 = ops::Add(a2, ops::Load(p + i + ops::kWidth * 2));
+            a3 = ops::Add(a3, ops::Load(p + i + ops::kWidth * 3));
+        }
+
+        for (; i + ops::kWidth <= n; i += ops::kWidth) {
+            a0 = ops::Add(a0, ops::Load(p + i));
+        }
+
+        res = ops::ReduceAdd(ops::Add(ops::Add(a0, a1), ops::Add(a2, a3)));
+    }
+
+    // The types without VectorOps, e.g. the 8 and 16-bit integers, are added by the plain loop below, which the
+    // compiler vectorizes itself. GCC 12 miscompiles a scalar unroll into several accumulators of them at -O3.
+    // The loop counts the remaining values down, GCC otherwise cannot bound it after the vector loops and reports a
+    // bogus overflow once n is known at compile time, e.g. with -mavx2.
+    for (size_t k = n - i; k > 0; k--) {
+        res += p[n - k];
+    }
+
+    return res;
+}
+
+// SumBy adds up f(p[i]) for n values stored contiguously. The results with VectorOps are accumulated into
+// kAccumulatorCount independent accumulators of type R, the others by a plain loop as in Sum.
+template <typename R, typename P, typename F>
+inline R SumBy(P* p, size_t n, F& f) {
+    size_t i = 0;
+    auto res = R();
+
+    if constexpr (has_vector_ops_v<R>) {
+        // The bound of the unrolled loop is computed upfront, GCC otherwise reports a bogus overflow of the tail loop
+        // once n is known at compile time.
+        const size_t unrolled = n - n % kAccumulatorCount;
+
+        R a[kAccumulatorCount] = {};
+
+        for (; i < unrolled; i += kAccumulatorCount) {
+            a[0] += f(p[i]);
+            a[1] += f(p[i + 1]);
+            a[2] += f(p[i + 2]);
+            a[3] += f(p[i + 3]);
+        }
+
+        res = R((a[0] + a[1]) + (a[2] + a[3]));
+    }
+
+    for (; i < n; i++) {
+        res += f(p[i]);
+    }
+
+    return res;
+}
+
+}  // namespace lodash::simd
+
+#endif  // LODASH_SIMD_SUM_H
@@ -2,22 +2,64 @@
 #define LODASH_SLICE_H
 
 #include <iterator>
-#include <set>
 #include <type_traits>
 
+#include "./container/flatten_range.h"
+#include "./execution.h"
+#include "./stats.h"
 #include "./type_check/is_iterable.h"
+#include "./type_check/is_random_access.h"
+#include "./type_check/is_std_array.h"
+#include "./type_utility/compact_into.h"
+#include "./type_utility/compare_predicate.h"
+#include "./type_utility/flatten_into.h"
 #include "./type_utility/get_flatten_container_value_type.h"
 #include "./type_utility/get_result_type.h"
+#include "./type_utility/get_size_hint.h"
+#include "./type_utility/is_constant_evaluated.h"
+#include "./type_utility/map_array.h"
+#include "./type_utility/memory_resource.h"
+#include "./type_utility/parallel_for.h"
 #include "./type_utility/push_back_to_container.h"
+#include "./type_utility/recycle.h"
 #include "./type_utility/reduce_handler.h"
+#include "./type_utility/reserve_container.h"
+#include "./type_utility/retain_if.h"
+#include "./type_utility/unique_set.h"
 #include "./type_utility/visit_container.h"
 
 namespace lodash {
 
 // Map manipulates a slice and transforms it to a slice of another type.
-template <typename R, typename Container, typename F>
-inline auto Map(Container&& c, F&& f) {
-    auto res = R();
+// Called with a `std::pmr::memory_resource*`, the result allocates from it if R is allocator-aware.
+// An rvalue input of type R is transformed in place and returned.
+template <typename R,
+          typename Resource,
+          typename Container,
+          typename F,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Map(Resource resource, Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kMap);
+
+    if constexpr (type_utility::is_recyclable_v<R, Container> && !type_check::is_map<R>) {
+        using result_type = type_utility::get_result_type_t<Container, F>;
+
+        if constexpr (std::is_assignable_v<decltype(*std::begin(c)), result_type>) {
+            if (type_utility::CanRecycle(c, resource)) {
+                size_t ix = 0;
+                for (auto&& v : c) {
+                    v = type_utility::InvokeVisitor<R>(f, v, ix++);
+                }
+
+                recorder.AddVisits(ix);
+                recorder.SetResult(c);
+                return R(std::move(c));
+            }
+        }
+    }
+
+    auto res = type_utility::MakeContainer<R>(resource);
+    type_utility::ReserveContainer(res, type_utility::GetSizeHint(c));
 
     type_utility::VisitContainer(std::forward<Container>(c),
                                  std::forward<F>(f),
@@ -26,143 +68,686 @@ inline auto Map(Container&& c, F&& f) {
                                      return type_utility::ReturnInfo{};
                                  });
 
+    recorder.SetResult(res);
     return res;
 }
 
+template <typename Resource,
+          typename Container,
+          typename F,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Map(Resource resource, Container&& c, F&& f) {
+    using r = type_utility::get_result_type_t<Container, F>;
+    return Map<type_utility::rebind_container_t<std::vector<r>, Resource>>(
+            resource, std::forward<Container>(c), std::forward<F>(f));
+}
+
+namespace slice_internal {
+
+// MapArray records the run time calls of Map over a std::array.
 template <typename Container, typename F>
-inline auto Map(Container&& c, F&& f) {
+inline auto MapArray(Container& c, F& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kMap);
+    auto res = type_utility::MapArray(c, f);
+    recorder.SetResult(res);
+    return res;
+}
+
+}  // namespace slice_internal
+
+// `Map<R>(c, f)` returns an R. Without R, Map of a std::array returns a std::array of the same size, see
+// type_utility::MapArray, which can be built in a constant expression.
+// R is a defaulted parameter of this overload rather than a separate one, which an rvalue input of type R would make
+// ambiguous, the same goes for Filter, Reject, Uniq and Intersect.
+template <typename R = void, typename Container, typename F>
+constexpr auto Map(Container&& c, F&& f) {
+    if constexpr (!std::is_void_v<R>) {
+        return Map<R>(type_utility::DefaultResource{}, std::forward<Container>(c), std::forward<F>(f));
+    } else if constexpr (type_check::is_std_array<std::decay_t<Container>>) {
+        if (type_utility::IsConstantEvaluated()) {
+            return type_utility::MapArray(c, f);
+        }
+
+        return slice_internal::MapArray(c, f);
+    } else {
+        return Map(type_utility::DefaultResource{}, std::forward<Container>(c), std::forward<F>(f));
+    }
+}
+
+// Map with an execution policy. Under `par`, a random-access input is split into chunks which are transformed
+// concurrently, so `f` must be safe to call from multiple threads. The order of the result is the same as the
+// sequential version.
+template <typename R,
+          typename Policy,
+          typename Container,
+          typename F,
+          std::enable_if_t<execution::is_execution_policy_v<Policy>, bool> = true>
+inline auto Map(Policy&& policy, Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kMap);
+
+    if constexpr (std::is_same_v<std::decay_t<Policy>, execution::ParallelPolicy> &&
+                  type_check::is_random_access<std::decay_t<Container>>) {
+        auto first = std::begin(c);
+        auto n = static_cast<size_t>(std::end(c) - first);
+        auto chunk_count = type_utility::GetChunkCount(policy, n);
+
+        if (chunk_count > 1) {
+            auto parts = std::vector<R>(chunk_count);
+
+            type_utility::ParallelForChunks(policy, chunk_count, n, [&](size_t chunk_ix, size_t begin, size_t end) {
+                auto& part = parts[chunk_ix];
+                type_utility::ReserveContainer(part, end - begin);
+                for (size_t i = begin; i < end; i++) {
+                    type_utility::PushBackToContainer(part, type_utility::InvokeWithIndex(f, first[i], i));
+                }
+            });
+
+            auto res = std::move(parts[0]);
+            type_utility::ReserveContainer(res, n - type_utility::GetSizeHint(res));
+            for (size_t i = 1; i < chunk_count; i++) {
+                for (auto&& v : parts[i]) {
+                    type_utility::PushBackToContainer(res, std::move(v));
+                }
+            }
+
+            recorder.AddVisits(n);
+            recorder.SetResult(res);
+            return res;
+        }
+    }
+
+    return Map<R>(std::forward<Container>(c), std::forward<F>(f));
+}
+
+template <typename Policy,
+          typename Container,
+          typename F,
+          std::enable_if_t<execution::is_execution_policy_v<Policy>, bool> = true>
+inline auto Map(Policy&& policy, Container&& c, F&& f) {
     using r = type_utility::get_result_type_t<Container, F>;
-    return Map<std::vector<r>>(std::forward<Container>(c), std::forward<F>(f));
+    return Map<std::vector<r>>(std::forward<Policy>(policy), std::forward<Container>(c), std::forward<F>(f));
 }
 
 // Reduce reduces collection to a value which is the accumulated result of running each element in collection
 // through accumulator, where each successive invocation is supplied the return value of the previous.
 template <typename Container, typename F, typename T>
 inline auto Reduce(Container&& c, F&& f, T&& init) {
+    auto recorder = stats::Recorder(stats::Algorithm::kReduce);
+
     auto h = type_utility::ReduceHandler(std::forward<F>(f), std::forward<T>(init));
     type_utility::VisitContainer(std::forward<Container>(c), h);
     return h.GetRes();
 }
 
-// Filter iterates over elements of collection, returning an container of all elements predicate returns truthy for.
-template <typename Container, typename F>
-inline auto Filter(Container&& c, F&& f) {
-    auto res = std::decay_t<Container>();
+namespace slice_internal {
 
-    type_utility::VisitContainer(std::forward<Container>(c),
-                                 std::forward<F>(f),
-                                 [&res](auto&& r, auto&& value, [[maybe_unused]] auto&& node_info) {
-                                     if (r) {
-                                         type_utility::PushBackToContainer(res, value);
-                                     }
+// ReduceParts reduces each chunk of a random-access input with f starting from init, on the executor of the policy,
+// and returns the partial results in chunk order. It returns no parts if the input is too small to be split, which
+// the callers then reduce sequentially.
+template <typename Container, typename F, typename T>
+inline auto ReduceParts(const execution::ParallelPolicy& policy,
+                        Container& c,
+                        F& f,
+                        const T& init,
+                        stats::Recorder& recorder) {
+    using result_type = std::decay_t<T>;
+
+    auto first = std::begin(c);
+    auto n = static_cast<size_t>(std::end(c) - first);
+    auto chunk_count = type_utility::GetChunkCount(policy, n);
+
+    auto parts = std::vector<result_type>();
+    if (chunk_count > 1) {
+        parts.resize(chunk_count, init);
+
+        type_utility::ParallelForChunks(policy, chunk_count, n, [&](size_t chunk_ix, size_t begin, size_t end) {
+            auto& part = parts[chunk_ix];
+            for (size_t i = begin; i < end; i++) {
+                if constexpr (type_check::has_func_args_3<F&, result_type&, decltype(first[i]), size_t>) {
+                    part = f(part, first[i], i);
+                } else {
+                    part = f(part, first[i]);
+                }
+            }
+        });
 
-                                     return type_utility::ReturnInfo{};
-                                 });
+        recorder.AddVisits(n);
+    }
+
+    return parts;
+}
+
+}  // namespace slice_internal
+
+// Reduce with an execution policy. Under `par`, each chunk of a random-access input is reduced starting from `init`
+// and the partial results are combined with `f` again, so `f` must be associative, accept two accumulated values and
+// `init` must be its identity element.
+template <typename Policy,
+          typename Container,
+          typename F,
+          typename T,
+          std::enable_if_t<execution::is_execution_policy_v<Policy>, bool> = true>
+inline auto Reduce(Policy&& policy, Container&& c, F&& f, T&& init) {
+    auto recorder = stats::Recorder(stats::Algorithm::kReduce);
+
+    if constexpr (std::is_same_v<std::decay_t<Policy>, execution::ParallelPolicy> &&
+                  type_check::is_random_access<std::decay_t<Container>>) {
+        auto parts = slice_internal::ReduceParts(policy, c, f, init, recorder);
+        if (!parts.empty()) {
+            auto res = std::move(parts[0]);
+            for (size_t i = 1; i < parts.size(); i++) {
+                res = f(res, parts[i]);
+            }
+
+            return res;
+        }
+    }
+
+    return Reduce(std::forward<Container>(c), std::forward<F>(f), std::forward<T>(init));
+}
+
+// ReduceParallel reduces a random-access input chunk by chunk on the executor of the policy: each chunk is reduced
+// with f starting from `init`, and the partial results of the chunks are combined with `combine` in a balanced tree,
+// see type_utility::CombineTree. `combine` must be associative and `init` must be its identity element. The chunks
+// only depend on the size of the input and on the policy, so the result is reproducible for a given concurrency,
+// floating-point sums included. Other inputs, and inputs too small to be split, are reduced sequentially with f.
+template <typename Policy,
+          typename Container,
+          typename F,
+          typename T,
+          typename Combine,
+          std::enable_if_t<execution::is_execution_policy_v<Policy>, bool> = true>
+inline auto ReduceParallel(Policy&& policy, Container&& c, F&& f, T&& init, Combine&& combine) {
+    auto recorder = stats::Recorder(stats::Algorithm::kReduceParallel);
+
+    if constexpr (std::is_same_v<std::decay_t<Policy>, execution::ParallelPolicy> &&
+                  type_check::is_random_access<std::decay_t<Container>>) {
+        auto parts = slice_internal::ReduceParts(policy, c, f, init, recorder);
+        if (!parts.empty()) {
+            return type_utility::CombineTree(parts, combine);
+        }
+    }
+
+    return Reduce(std::forward<Container>(c), std::forward<F>(f), std::forward<T>(init));
+}
+
+template <typename Container, typename F, typename T, typename Combine>
+inline auto ReduceParallel(Container&& c, F&& f, T&& init, Combine&& combine) {
+    return ReduceParallel(par,
+                          std::forward<Container>(c),
+                          std::forward<F>(f),
+                          std::forward<T>(init),
+                          std::forward<Combine>(combine));
+}
+
+// TransformReduce returns `combine(init, combine(transform(c[0]), ...))`, the transformed elements being combined in
+// any grouping, like std::transform_reduce. Under `par` a random-access input is split into chunks as for
+// ReduceParallel, each chunk combines its own transformed elements and the partial results are combined in a balanced
+// tree, so `combine` must be associative but `init` needs not be its identity. The result type is the type of init.
+template <typename Policy,
+          typename Container,
+          typename Transform,
+          typename Combine,
+          typename T,
+          std::enable_if_t<execution::is_execution_policy_v<Policy>, bool> = true>
+inline auto TransformReduce(Policy&& policy, Container&& c, Transform&& transform, Combine&& combine, T&& init) {
+    auto recorder = stats::Recorder(stats::Algorithm::kTransformReduce);
+
+    using result_type = std::decay_t<T>;
+
+    if constexpr (std::is_same_v<std::decay_t<Policy>, execution::ParallelPolicy> &&
+                  type_check::is_random_access<std::decay_t<Container>>) {
+        auto first = std::begin(c);
+        auto n = static_cast<size_t>(std::end(c) - first);
+        auto chunk_count = type_utility::GetChunkCount(policy, n);
+
+        if (chunk_count > 1) {
+            auto parts = std::vector<result_type>(chunk_count, init);
+
+            // A chunk is never empty, its partial result starts from its first element.
+            type_utility::ParallelForChunks(policy, chunk_count, n, [&](size_t chunk_ix, size_t begin, size_t end) {
+                auto& part = parts[chunk_ix];
+                part = type_utility::InvokeWithIndex(transform, first[begin], begin);
+                for (size_t i = begin + 1; i < end; i++) {
+                    part = combine(std::move(part), type_utility::InvokeWithIndex(transform, first[i], i));
+                }
+            });
+
+            recorder.AddVisits(n);
+            return result_type(combine(std::forward<T>(init), type_utility::CombineTree(parts, combine)));
+        }
+    }
+
+    auto res = result_type(std::forward<T>(init));
+
+    auto h = [&res, &combine](auto&& r, [[maybe_unused]] auto&& value, [[maybe_unused]] auto&& node_info) {
+        res = combine(std::move(res), std::forward<decltype(r)>(r));
+        return type_utility::ReturnInfo{};
+    };
+
+    type_utility::VisitContainer(std::forward<Container>(c), std::forward<Transform>(transform), h);
 
     return res;
 }
 
-// Reject is the opposite of Filter, this method returns the elements of collection that predicate does not return
-// truthy for.
+template <typename Container, typename Transform, typename Combine, typename T>
+inline auto TransformReduce(Container&& c, Transform&& transform, Combine&& combine, T&& init) {
+    return TransformReduce(par,
+                           std::forward<Container>(c),
+                           std::forward<Transform>(transform),
+                           std::forward<Combine>(combine),
+                           std::forward<T>(init));
+}
+
+// Filter iterates over elements of collection, returning an container of all elements predicate returns truthy for.
+// The result reserves the size of a sized input up front, which bounds the growth to a single allocation; callers
+// keeping a sparse result around can shrink_to_fit it. A result with inline storage, e.g. `Filter<SmallVector<T, N>>`,
+// reserves nothing, so a short result does not allocate.
+// Contiguous inputs of trivially copyable values are compacted without a branch per element, see simd::CompactBy.
+// An rvalue input of type R is filtered in place and returned, which allocates nothing.
+// Called with a `std::pmr::memory_resource*`, the result is the pmr counterpart of the container and allocates from it.
+template <typename R,
+          typename Resource,
+          typename Container,
+          typename F,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Filter(Resource resource, Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kFilter);
+    if constexpr (type_utility::is_recyclable_v<R, Container>) {
+        if (type_utility::CanRecycle(c, resource)) {
+            type_utility::RetainIf(c, f, true);
+            recorder.SetResult(c);
+            return R(std::move(c));
+        }
+    }
+
+    auto res = type_utility::MakeContainer<R>(resource);
+    type_utility::ReserveUpTo(res, type_utility::GetSizeHint(c));
+
+    if constexpr (type_utility::use_compaction_into<R, Container, F>) {
+        recorder.VisitAll(c);
+        type_utility::CompactInto(res, c.data(), c.size(), f, true);
+    } else {
+        type_utility::VisitContainer(std::forward<Container>(c),
+                                     std::forward<F>(f),
+                                     [&res](auto&& r, auto&& value, [[maybe_unused]] auto&& node_info) {
+                                         if (r) {
+                                             type_utility::PushBackToContainer(res, value);
+                                         }
+
+                                         return type_utility::ReturnInfo{};
+                                     });
+    }
+
+    recorder.SetResult(res);
+    return res;
+}
+
+template <typename Resource,
+          typename Container,
+          typename F,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Filter(Resource resource, Container&& c, F&& f) {
+    using R = type_utility::rebind_container_t<std::decay_t<Container>, Resource>;
+    return Filter<R>(resource, std::forward<Container>(c), std::forward<F>(f));
+}
+
+// `Filter<R>(c, f)` returns an R. Without R, Filter of a std::array returns a container::StaticVector of the same
+// capacity, which can be built in a constant expression.
+template <typename R = void, typename Container, typename F>
+constexpr auto Filter(Container&& c, F&& f) {
+    if constexpr (!std::is_void_v<R>) {
+        return Filter<R>(type_utility::DefaultResource{}, std::forward<Container>(c), std::forward<F>(f));
+    } else {
+        if constexpr (type_check::is_std_array<std::decay_t<Container>>) {
+            if (type_utility::IsConstantEvaluated()) {
+                return type_utility::FilterArray(c, f);
+            }
+        }
+
+        return Filter(type_utility::DefaultResource{}, std::forward<Container>(c), std::forward<F>(f));
+    }
+}
+
+// Filter with an execution policy. Under `par`, the chunks of a random-access input are filtered concurrently and
+// concatenated in order, so `f` must be safe to call from multiple threads.
+template <typename Policy,
+          typename Container,
+          typename F,
+          std::enable_if_t<execution::is_execution_policy_v<Policy>, bool> = true>
+inline auto Filter(Policy&& policy, Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kFilter);
+
+    if constexpr (std::is_same_v<std::decay_t<Policy>, execution::ParallelPolicy> &&
+                  type_check::is_random_access<std::decay_t<Container>>) {
+        auto first = std::begin(c);
+        auto n = static_cast<size_t>(std::end(c) - first);
+        auto chunk_count = type_utility::GetChunkCount(policy, n);
+
+        if (chunk_count > 1) {
+            // The parts are built as the result of the sequential Filter, the input may not be buildable itself, e.g.
+            // a std::array or a RangeView.
+            using R = type_utility::rebind_container_t<std::decay_t<Container>, type_utility::DefaultResource>;
+            auto parts = std::vector<R>(chunk_count);
+
+            type_utility::ParallelForChunks(policy, chunk_count, n, [&](size_t chunk_ix, size_t begin, size_t end) {
+                auto& part = parts[chunk_ix];
+                if constexpr (type_utility::use_compaction_into<R, Container, F>) {
+                    type_utility::CompactInto(part, c.data() + begin, end - begin, f, true);
+                } else {
+                    for (size_t i = begin; i < end; i++) {
+                        if (type_utility::InvokeWithIndex(f, first[i], i)) {
+                            type_utility::PushBackToContainer(part, first[i]);
+                        }
+                    }
+                }
+            });
+
+            auto rest_size = size_t(0);
+            for (size_t i = 1; i < chunk_count; i++) {
+                rest_size += type_utility::GetSizeHint(parts[i]);
+            }
+
+            auto res = std::move(parts[0]);
+            type_utility::ReserveContainer(res, rest_size);
+            for (size_t i = 1; i < chunk_count; i++) {
+                for (auto&& v : parts[i]) {
+                    type_utility::PushBackToContainer(res, std::move(v));
+                }
+            }
+
+            recorder.AddVisits(n);
+            recorder.SetResult(res);
+            return res;
+        }
+    }
+
+    return Filter(std::forward<Container>(c), std::forward<F>(f));
+}
+
+// FilterInPlace erases the elements of the container which predicate returns falsy for, keeping the order of the
+// others. Nothing is allocated and the extra memory is O(1), the capacity of the container is left unchanged.
 template <typename Container, typename F>
-inline auto Reject(Container&& c, F&& f) {
-    auto res = std::decay_t<Container>();
+inline void FilterInPlace(Container& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kFilterInPlace);
+    type_utility::RetainIf(c, f, true);
+    recorder.SetResult(c);
+}
 
-    type_utility::VisitContainer(std::forward<Container>(c),
-                                 std::forward<F>(f),
-                                 [&res](auto&& r, auto&& value, [[maybe_unused]] auto&& node_info) {
-                                     if (!r) {
-                                         type_utility::PushBackToContainer(res, value);
-                                     }
+// Reject is the opposite of Filter, this method returns the elements of collection that predicate does not return
+// truthy for.
+template <typename R,
+          typename Resource,
+          typename Container,
+          typename F,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Reject(Resource resource, Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kReject);
+    if constexpr (type_utility::is_recyclable_v<R, Container>) {
+        if (type_utility::CanRecycle(c, resource)) {
+            type_utility::RetainIf(c, f, false);
+            recorder.SetResult(c);
+            return R(std::move(c));
+        }
+    }
 
-                                     return type_utility::ReturnInfo{};
-                                 });
+    auto res = type_utility::MakeContainer<R>(resource);
+    type_utility::ReserveUpTo(res, type_utility::GetSizeHint(c));
+
+    if constexpr (type_utility::use_compaction_into<R, Container, F>) {
+        recorder.VisitAll(c);
+        type_utility::CompactInto(res, c.data(), c.size(), f, false);
+    } else {
+        type_utility::VisitContainer(std::forward<Container>(c),
+                                     std::forward<F>(f),
+                                     [&res](auto&& r, auto&& value, [[maybe_unused]] auto&& node_info) {
+                                         if (!r) {
+                                             type_utility::PushBackToContainer(res, value);
+                                         }
+
+                                         return type_utility::ReturnInfo{};
+                                     });
+    }
 
+    recorder.SetResult(res);
     return res;
 }
 
+template <typename Resource,
+          typename Container,
+          typename F,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Reject(Resource resource, Container&& c, F&& f) {
+    using R = type_utility::rebind_container_t<std::decay_t<Container>, Resource>;
+    return Reject<R>(resource, std::forward<Container>(c), std::forward<F>(f));
+}
+
+template <typename R = void, typename Container, typename F>
+inline auto Reject(Container&& c, F&& f) {
+    if constexpr (std::is_void_v<R>) {
+        return Reject(type_utility::DefaultResource{}, std::forward<Container>(c), std::forward<F>(f));
+    } else {
+        return Reject<R>(type_utility::DefaultResource{}, std::forward<Container>(c), std::forward<F>(f));
+    }
+}
+
+// RejectInPlace erases the elements of the container which predicate returns truthy for, keeping the order of the
+// others.
+template <typename Container, typename F>
+inline void RejectInPlace(Container& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kRejectInPlace);
+    type_utility::RetainIf(c, f, false);
+    recorder.SetResult(c);
+}
+
 // ForEach iterates over elements of collection and invokes iteratee for each element.
 template <typename Container, typename F>
 inline void ForEach(Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kForEach);
+
     type_utility::VisitContainer(std::forward<Container>(c), std::forward<F>(f));
 }
 
+// FlattenDepth returns a container with Depth levels of the nested container flattened, Flatten flattens all of them.
+// The result is sized up front and the elements are appended to it directly, without an intermediate container per
+// level. The elements of an rvalue input are moved into the result.
+// Called with a `std::pmr::memory_resource*`, the result is a std::pmr::vector allocating from it.
+template <size_t Depth,
+          typename Resource,
+          typename Container,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto FlattenDepth(Resource resource, Container&& c) {
+    auto recorder = stats::Recorder(stats::Algorithm::kFlattenDepth);
+
+    using value_type = type_utility::get_flatten_depth_value_type_t<Container, Depth>;
+    using R = type_utility::rebind_container_t<std::vector<value_type>, Resource>;
+    auto res = type_utility::MakeContainer<R>(resource);
+
+    type_utility::ReserveContainer(res, type_utility::GetFlattenSize<Depth>(c));
+    type_utility::FlattenInto<Depth>(res, std::forward<Container>(c));
+
+    recorder.VisitAll(res);
+    recorder.SetResult(res);
+    return res;
+}
+
+template <size_t Depth, typename Container>
+inline auto FlattenDepth(Container&& c) {
+    return FlattenDepth<Depth>(type_utility::DefaultResource{}, std::forward<Container>(c));
+}
+
 // Flatten returns an container a single level deep.
+// The elements of an rvalue input are moved into the result.
+// Called with a `std::pmr::memory_resource*`, the result is a std::pmr::vector allocating from it.
+template <typename Resource, typename Container, std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Flatten(Resource resource, Container&& c) {
+    auto recorder = stats::Recorder(stats::Algorithm::kFlatten);
+    return FlattenDepth<type_utility::kFlattenFullDepth>(resource, std::forward<Container>(c));
+}
+
 template <typename Container>
 inline auto Flatten(Container&& c) {
-    auto res = std::vector<type_utility::get_flatten_container_value_type_t<Container>>();
-
-    for (auto&& v : c) {
-        if constexpr (type_check::is_iterable<std::decay_t<decltype(v)>>) {
-            auto v_res = Flatten(v);
-            res.insert(res.end(), v_res.begin(), v_res.end());
-        } else {
-            type_utility::PushBackToContainer(res, v);
-        }
-    }
+    return Flatten(type_utility::DefaultResource{}, std::forward<Container>(c));
+}
 
-    return res;
+// FlattenView returns a view iterating over the elements of the container with Depth levels of it flattened, it does
+// not copy them. The view refers to the container, which must outlive it.
+template <size_t Depth = type_utility::kFlattenFullDepth, typename Container>
+inline auto FlattenView(Container& c) {
+    return container::FlattenRange<Container, Depth>(c);
 }
 
+template <size_t Depth = type_utility::kFlattenFullDepth, typename Container>
+void FlattenView(const Container&& c) = delete;
+
 // Times invokes the iteratee n times, returning an array of the results of each invocation.
 // The iteratee is invoked with index as argument.
-template <typename F>
-inline auto Times(size_t count, F&& f) {
-    using result_type = std::result_of_t<F(size_t)>;
-    auto res = std::vector<result_type>();
+// Called with a `std::pmr::memory_resource*`, the result is a std::pmr::vector allocating from it.
+template <typename Resource, typename F, std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Times(Resource resource, size_t count, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kTimes);
+
+    using result_type = std::invoke_result_t<F, size_t>;
+    using R = type_utility::rebind_container_t<std::vector<result_type>, Resource>;
+    auto res = type_utility::MakeContainer<R>(resource);
+    type_utility::ReserveContainer(res, count);
 
     for (size_t i = 0; i < count; i++) {
         type_utility::PushBackToContainer(res, f(i));
     }
 
+    recorder.AddVisits(count);
+    recorder.SetResult(res);
     return res;
 }
 
+template <typename F>
+inline auto Times(size_t count, F&& f) {
+    return Times(type_utility::DefaultResource{}, count, std::forward<F>(f));
+}
+
 // Uniq returns a duplicate-free version of an array, in which only the first occurrence of each element is kept.
 // The order of result values is determined by the order they occur in the array.
-template <typename Container>
-inline auto Uniq(Container&& c) {
+// Called with a `std::pmr::memory_resource*`, both the result and the scratch set allocate from it.
+// An rvalue input is deduplicated in place and returned.
+// `Uniq<R>` builds an R, e.g. a container::SmallVector which keeps a short result inline.
+template <typename R,
+          typename Resource,
+          typename Container,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Uniq(Resource resource, Container&& c) {
     using value_type = typename std::decay_t<Container>::value_type;
-    auto res = std::decay_t<Container>();
-    auto se = std::set<value_type>();
+    auto recorder = stats::Recorder(stats::Algorithm::kUniq);
+    auto se = type_utility::MakeUniqueSet<value_type>(type_utility::GetSizeHint(c), resource);
+
+    if constexpr (type_utility::is_recyclable_v<R, Container>) {
+        if (type_utility::CanRecycle(c, resource)) {
+            auto is_first = [&se](const value_type& v) {
+                return se.insert(v).second;
+            };
+
+            type_utility::RetainIf(c, is_first, true);
+            recorder.AddScratch(se);
+            recorder.SetResult(c);
+            return R(std::move(c));
+        }
+    }
 
+    auto res = type_utility::MakeContainer<R>(resource);
     for (auto&& v : c) {
-        if (se.find(v) == se.end()) {
-            se.insert(v);
+        if (se.insert(v).second) {
             type_utility::PushBackToContainer(res, v);
         }
     }
 
+    recorder.VisitAll(c);
+    recorder.AddScratch(se);
+    recorder.SetResult(res);
     return res;
 }
 
+template <typename Resource, typename Container, std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Uniq(Resource resource, Container&& c) {
+    using R = type_utility::rebind_container_t<std::decay_t<Container>, Resource>;
+    return Uniq<R>(resource, std::forward<Container>(c));
+}
+
+template <typename R = void, typename Container>
+inline auto Uniq(Container&& c) {
+    if constexpr (std::is_void_v<R>) {
+        return Uniq(type_utility::DefaultResource{}, std::forward<Container>(c));
+    } else {
+        return Uniq<R>(type_utility::DefaultResource{}, std::forward<Container>(c));
+    }
+}
+
+// UniqInPlace erases all but the first occurrence of each element of the container, keeping their order.
+// The seen elements are tracked in a hash set (an ordered set for non-hashable types), the container itself is
+// compacted without allocating.
+template <typename Container>
+inline void UniqInPlace(Container& c) {
+    using value_type = typename Container::value_type;
+    auto recorder = stats::Recorder(stats::Algorithm::kUniqInPlace);
+    auto se = type_utility::MakeUniqueSet<value_type>(type_utility::GetSizeHint(c));
+
+    auto is_first = [&se](const value_type& v) {
+        return se.insert(v).second;
+    };
+
+    type_utility::RetainIf(c, is_first, true);
+    recorder.AddScratch(se);
+    recorder.SetResult(c);
+}
+
 // UniqBy returns a duplicate-free version of an array, in which only the first occurrence of each element is kept.
 // The order of result values is determined by the order they occur in the array. It accepts `iteratee` which is
 // invoked for each element in array to generate the criterion by which uniqueness is computed.
-template <typename Container, typename F>
-inline auto UniqBy(Container&& c, F&& f) {
+template <typename R,
+          typename Resource,
+          typename Container,
+          typename F,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto UniqBy(Resource resource, Container&& c, F&& f) {
     using result_type = type_utility::get_result_type_t<Container, F>;
-    auto res = std::decay_t<Container>();
-    auto se = std::set<result_type>();
+    auto recorder = stats::Recorder(stats::Algorithm::kUniqBy);
+    auto res = type_utility::MakeContainer<R>(resource);
+    auto se = type_utility::MakeUniqueSet<std::decay_t<result_type>>(type_utility::GetSizeHint(c), resource);
 
     type_utility::VisitContainer(
             std::forward<Container>(c),
             std::forward<F>(f),
             [&se, &res](auto&& r, [[maybe_unused]] auto&& value, [[maybe_unused]] auto&& node_info) {
-                if (se.find(r) == se.end()) {
-                    se.insert(r);
+                if (se.insert(std::forward<decltype(r)>(r)).second) {
                     type_utility::PushBackToContainer(res, value);
                 }
 
                 return type_utility::ReturnInfo{};
             });
 
+    recorder.AddScratch(se);
+    recorder.SetResult(res);
     return res;
 }
 
+template <typename Resource,
+          typename Container,
+          typename F,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto UniqBy(Resource resource, Container&& c, F&& f) {
+    using R = type_utility::rebind_container_t<std::decay_t<Container>, Resource>;
+    return UniqBy<R>(resource, std::forward<Container>(c), std::forward<F>(f));
+}
+
+template <typename Container, typename F>
+inline auto UniqBy(Container&& c, F&& f) {
+    return UniqBy(type_utility::DefaultResource{}, std::forward<Container>(c), std::forward<F>(f));
+}
+
 // CountBy counts the number of elements in the collection for which predicate is true.
 template <typename Container, typename F>
 inline size_t CountBy(Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kCountBy);
+
     size_t count = 0;
 
     type_utility::VisitContainer(std::forward<Container>(c),
@@ -178,18 +763,102 @@ inline size_t CountBy(Container&& c, F&& f) {
     return count;
 }
 
+// CountBy with an execution policy. Under `par`, the chunks of a random-access input are counted concurrently, so `f`
+// must be safe to call from multiple threads.
+template <typename Policy,
+          typename Container,
+          typename F,
+          std::enable_if_t<execution::is_execution_policy_v<Policy>, bool> = true>
+inline size_t CountBy(Policy&& policy, Container&& c, F&& f) {
+    auto recorder = stats::Recorder(stats::Algorithm::kCountBy);
+
+    if constexpr (std::is_same_v<std::decay_t<Policy>, execution::ParallelPolicy> &&
+                  type_check::is_random_access<std::decay_t<Container>>) {
+        auto first = std::begin(c);
+        auto n = static_cast<size_t>(std::end(c) - first);
+        auto chunk_count = type_utility::GetChunkCount(policy, n);
+
+        if (chunk_count > 1) {
+            auto parts = std::vector<size_t>(chunk_count);
+
+            type_utility::ParallelForChunks(policy, chunk_count, n, [&](size_t chunk_ix, size_t begin, size_t end) {
+                size_t count = 0;
+                for (size_t i = begin; i < end; i++) {
+                    if (type_utility::InvokeWithIndex(f, first[i], i)) {
+                        ++count;
+                    }
+                }
+
+                parts[chunk_ix] = count;
+            });
+
+            size_t count = 0;
+            for (auto&& part : parts) {
+                count += part;
+            }
+
+            recorder.AddVisits(n);
+            return count;
+        }
+    }
+
+    return CountBy(std::forward<Container>(c), std::forward<F>(f));
+}
+
 // Count counts the number of elements in the collection that compare equal to value.
 template <typename Container, typename T>
 inline size_t Count(Container&& c, T&& t) {
+    auto recorder = stats::Recorder(stats::Algorithm::kCount);
+
     return CountBy(std::forward<Container>(c), [t](auto&& x) {
         return x == t;
     });
 }
 
-// Replace returns a copy of the slice with the first n non-overlapping instances of old replaced by new.
+// ReplaceInPlace replaces the first n instances of old by new in the container itself.
 template <typename Container, typename T>
-inline auto Replace(Container&& c, T&& old_element, T&& new_element, size_t n = -1) {
-    auto res = std::decay_t<Container>();
+inline void ReplaceInPlace(Container& c, T&& old_element, T&& new_element, size_t n = -1) {
+    auto recorder = stats::Recorder(stats::Algorithm::kReplaceInPlace);
+
+    size_t visited = 0;
+    for (auto&& v : c) {
+        if (n == 0) {
+            recorder.EarlyExit();
+            break;
+        }
+
+        if (v == old_element) {
+            v = new_element;
+            --n;
+        }
+
+        ++visited;
+    }
+
+    recorder.AddVisits(visited);
+    recorder.SetResult(c);
+}
+
+// Replace returns a copy of the slice with the first n non-overlapping instances of old replaced by new.
+// Called with a `std::pmr::memory_resource*`, the result is the pmr counterpart of the container and allocates from it.
+// An rvalue input is modified in place and returned.
+template <typename Resource,
+          typename Container,
+          typename T,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Replace(Resource resource, Container&& c, T&& old_element, T&& new_element, size_t n = -1) {
+    using R = type_utility::rebind_container_t<std::decay_t<Container>, Resource>;
+    auto recorder = stats::Recorder(stats::Algorithm::kReplace);
+
+    if constexpr (type_utility::is_recyclable_v<R, Container>) {
+        if (type_utility::CanRecycle(c, resource)) {
+            ReplaceInPlace(c, old_element, new_element, n);
+            return R(std::move(c));
+        }
+    }
+
+    auto res = type_utility::MakeContainer<R>(resource);
+    type_utility::ReserveContainer(res, type_utility::GetSizeHint(c));
 
     for (auto&& v : c) {
         if (v == old_element && n != 0) {
@@ -200,24 +869,64 @@ inline auto Replace(Container&& c, T&& old_element, T&& new_element, size_t n =
         }
     }
 
+    recorder.VisitAll(c);
+    recorder.SetResult(res);
     return res;
 }
 
+template <typename Container, typename T>
+inline auto Replace(Container&& c, T&& old_element, T&& new_element, size_t n = -1) {
+    return Replace(type_utility::DefaultResource{},
+                   std::forward<Container>(c),
+                   std::forward<T>(old_element),
+                   std::forward<T>(new_element),
+                   n);
+}
+
 // ReplaceAll returns a copy of the slice with all non-overlapping instances of old replaced by new.
+template <typename Resource,
+          typename Container,
+          typename T,
+          std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto ReplaceAll(Resource resource, Container&& c, T&& old_element, T&& new_element) {
+    auto recorder = stats::Recorder(stats::Algorithm::kReplaceAll);
+
+    return Replace(
+            resource, std::forward<Container>(c), std::forward<T>(old_element), std::forward<T>(new_element), -1);
+}
+
 template <typename Container, typename T>
 inline auto ReplaceAll(Container&& c, T&& old_element, T&& new_element) {
-    return Replace(std::forward<Container>(c), std::forward<T>(old_element), std::forward<T>(new_element), -1);
+    return ReplaceAll(type_utility::DefaultResource{},
+                      std::forward<Container>(c),
+                      std::forward<T>(old_element),
+                      std::forward<T>(new_element));
 }
 
 // Compact returns a slice of all non-zero elements.
+template <typename Resource, typename Container, std::enable_if_t<type_utility::is_resource_v<Resource>, bool> = true>
+inline auto Compact(Resource resource, Container&& c) {
+    using value_type = typename std::decay_t<Container>::value_type;
+    auto recorder = stats::Recorder(stats::Algorithm::kCompact);
+    auto not_zero = type_utility::ComparePredicate<type_utility::CompareOp::kNe, value_type>{value_type()};
+
+    return Filter(resource, std::forward<Container>(c), not_zero);
+}
+
 template <typename Container>
 inline auto Compact(Container&& c) {
-    using value_type = typename std::decay_t<Container>::value_type;
-    auto zero = value_type();
+    return Compact(type_utility::DefaultResource{}, std::forward<Container>(c));
+}
 
-    return Filter(std::forward<Container>(c), [zero](auto&& x) {
-        return x != zero;
-    });
+// CompactInPlace erases all zero elements of the container, keeping the order of the others.
+template <typename Container>
+inline void CompactInPlace(Container& c) {
+    using value_type = typename Container::value_type;
+    auto recorder = stats::Recorder(stats::Algorithm::kCompactInPlace);
+    auto not_zero = type_utility::ComparePredicate<type_utility::CompareOp::kNe, value_type>{value_type()};
+
+    type_utility::RetainIf(c, not_zero, true);
+    recorder.SetResult(c);
 }
 
 }  // namespace lodash
@@ -0,0 +1,378 @@
+#ifndef LODASH_STATS_H
+#define LODASH_STATS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#ifdef LODASH_ENABLE_STATS
+#include <atomic>
+#include <mutex>
+#include <vector>
+#endif
+
+#include "./type_utility/get_size_hint.h"
+
+// The algorithms record what they do into thread-local counters when LODASH_ENABLE_STATS is defined, GetSnapshot
+// aggregates the counters of all threads. Without LODASH_ENABLE_STATS the recording compiles to nothing and
+// GetSnapshot returns zeros. The macro must be defined the same way in every translation unit of a program.
+namespace lodash::stats {
+
+// Algorithm enumerates the recorded algorithms. A call is recorded once, under the algorithm the caller called:
+// the lodash algorithms it delegates to, e.g. Compact to Filter, add their work to it instead of being recorded.
+enum class Algorithm : size_t {
+    kMap,
+    kReduce,
+    kReduceParallel,
+    kTransformReduce,
+    kFilter,
+    kFilterInPlace,
+    kReject,
+    kRejectInPlace,
+    kForEach,
+    kFlatten,
+    kFlattenDepth,
+    kTimes,
+    kUniq,
+    kUniqInPlace,
+    kUniqBy,
+    kCountBy,
+    kCount,
+    kReplace,
+    kReplaceAll,
+    kReplaceInPlace,
+    kCompact,
+    kCompactInPlace,
+    kContainsBy,
+    kContains,
+    kEveryBy,
+    kEvery,
+    kSomeBy,
+    kSome,
+    kNoneBy,
+    kNone,
+    kIntersect,
+    kUnion,
+    kIntersectSorted,
+    kUnionSorted,
+    kSum,
+    kSumBy,
+    kSumPairwise,
+    kSumPairwiseBy,
+    kSumKahan,
+    kSumKahanBy,
+    kRange,
+    kAlgorithmCount,
+};
+
+inline constexpr size_t kAlgorithmCount = static_cast<size_t>(Algorithm::kAlgorithmCount);
+
+inline const char* GetAlgorithmName(Algorithm algorithm) {
+    static constexpr std::array<const char*, kAlgorithmCount> kNames = {
+            "Map",
+            "Reduce",
+            "ReduceParallel",
+            "TransformReduce",
+            "Filter",
+            "FilterInPlace",
+            "Reject",
+            "RejectInPlace",
+            "ForEach",
+            "Flatten",
+            "FlattenDepth",
+            "Times",
+            "Uniq",
+            "UniqInPlace",
+            "UniqBy",
+            "CountBy",
+            "Count",
+            "Replace",
+            "ReplaceAll",
+            "ReplaceInPlace",
+            "Compact",
+            "CompactInPlace",
+            "ContainsBy",
+            "Contains",
+            "EveryBy",
+            "Every",
+            "SomeBy",
+            "Some",
+            "NoneBy",
+            "None",
+            "Intersect",
+            "Union",
+            "IntersectSorted",
+            "UnionSorted",
+            "Sum",
+            "SumBy",
+            "SumPairwise",
+            "SumPairwiseBy",
+            "SumKahan",
+            "SumKahanBy",
+            "Range",
+    };
+
+    return kNames[static_cast<size_t>(algorithm)];
+}
+
+struct AlgorithmStats {
+    // calls is the number of calls.
+    uint64_t calls{0};
+    // elements is the number of input elements visited.
+    uint64_t elements{0};
+    // early_exits is the number of calls which stopped as soon as their result was known, without visiting the rest of
+    // the input.
+    uint64_t early_exits{0};
+    // result_elements is the total size of the returned or modified containers.
+    uint64_t result_elements{0};
+    // scratch_elements is the total size of the scratch sets used to deduplicate or intersect.
+    uint64_t scratch_elements{0};
+};
+
+// Snapshot holds the counters of all algorithms summed over all threads since the start of the program.
+struct Snapshot {
+    std::array<AlgorithmStats, kAlgorithmCount> algorithms{};
+
+    const AlgorithmStats& operator[](Algorithm algorithm) const {
+        return algorithms[static_cast<size_t>(algorithm)];
+    }
+
+    // operator- returns the counters recorded between two snapshots.
+    Snapshot operator-(const Snapshot& before) const {
+        auto res = *this;
+        for (size_t i = 0; i < kAlgorithmCount; i++) {
+            res.algorithms[i].calls -= before.algorithms[i].calls;
+            res.algorithms[i].elements -= before.algorithms[i].elements;
+            res.algorithms[i].early_exits -= before.algorithms[i].early_exits;
+            res.algorithms[i].result_elements -= before.algorithms[i].result_elements;
+            res.algorithms[i].scratch_elements -= before.algorithms[i].scratch_elements;
+        }
+
+        return res;
+    }
+};
+
+#ifdef LODASH_ENABLE_STATS
+
+constexpr bool kEnabled = true;
+
+// Counters are only written by their thread, atomics let GetSnapshot read them concurrently.
+struct Counters {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> elements{0};
+    std::atomic<uint64_t> early_exits{0};
+    std::atomic<uint64_t> result_elements{0};
+    std::atomic<uint64_t> scratch_elements{0};
+};
+
+class Recorder;
+
+// ThreadCounters are the counters of one thread, they register themselves to the Registry for their lifetime.
+struct ThreadCounters {
+    ThreadCounters();
+    ~ThreadCounters();
+
+    std::array<Counters, kAlgorithmCount> counters;
+
+    // active is the Recorder of the outermost algorithm running on the thread.
+    Recorder* active{nullptr};
+};
+
+// Registry tracks the counters of the live threads, the counters of the exited threads are folded into retired.
+class Registry {
+public:
+    // Get never destroys the registry, so the threads which exit during the static destruction can still retire.
+    static Registry& Get() {
+        static auto* registry = new Registry();
+        return *registry;
+    }
+
+    void Add(ThreadCounters* t) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        threads_.push_back(t);
+    }
+
+    void Remove(ThreadCounters* t) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        AddTo(retired_, *t);
+
+        for (auto& p : threads_) {
+            if (p == t) {
+                p = threads_.back();
+                threads_.pop_back();
+                break;
+            }
+        }
+    }
+
+    Snapshot GetSnapshot() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto res = retired_;
+
+        for (auto* t : threads_) {
+            AddTo(res, *t);
+        }
+
+        return res;
+    }
+
+private:
+    static void AddTo(Snapshot& s, const ThreadCounters& t) {
+        for (size_t i = 0; i < kAlgorithmCount; i++) {
+            auto& c = t.counters[i];
+            auto& a = s.algorithms[i];
+
+            a.calls += c.calls.load(std::memory_order_relaxed);
+            a.elements += c.elements.load(std::memory_order_relaxed);
+            a.early_exits += c.early_exits.load(std::memory_order_relaxed);
+            a.result_elements += c.result_elements.load(std::memory_order_relaxed);
+            a.scratch_elements += c.scratch_elements.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::mutex mutex_;
+    std::vector<ThreadCounters*> threads_;
+    Snapshot retired_;
+};
+
+inline ThreadCounters::ThreadCounters() {
+    Registry::Get().Add(this);
+}
+
+inline ThreadCounters::~ThreadCounters() {
+    Registry::Get().Remove(this);
+}
+
+inline ThreadCounters& GetThreadCounters() {
+    thread_local ThreadCounters t;
+    return t;
+}
+
+// Recorder records one call of an algorithm when it goes out of scope. A Recorder created while another one is
+// active on the thread forwards what it records to the active one, so a call is only counted once.
+class Recorder {
+public:
+    explicit Recorder(Algorithm algorithm)
+            : algorithm_(algorithm), thread_(GetThreadCounters()), owner_(thread_.active ? thread_.active : this) {
+        thread_.active = owner_;
+    }
+
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+
+    ~Recorder() {
+        if (owner_ != this) {
+            return;
+        }
+
+        thread_.active = nullptr;
+
+        auto& c = thread_.counters[static_cast<size_t>(algorithm_)];
+        Add(c.calls, 1);
+        Add(c.elements, elements_);
+        Add(c.early_exits, early_exit_ ? 1 : 0);
+        Add(c.result_elements, result_elements_);
+        Add(c.scratch_elements, scratch_elements_);
+    }
+
+    void AddVisits(size_t n) {
+        owner_->elements_ += n;
+    }
+
+    // VisitAll records that all the elements of c were visited.
+    template <typename Container>
+    void VisitAll(const Container& c) {
+        AddVisits(GetSize(c));
+    }
+
+    void EarlyExit() {
+        owner_->early_exit_ = true;
+    }
+
+    template <typename Container>
+    void SetResult(const Container& c) {
+        owner_->result_elements_ = GetSize(c);
+    }
+
+    template <typename Container>
+    void AddScratch(const Container& c) {
+        owner_->scratch_elements_ += GetSize(c);
+    }
+
+    // Active returns the Recorder the work done on the thread is recorded to, or nullptr.
+    static Recorder* Active() {
+        return GetThreadCounters().active;
+    }
+
+private:
+    template <typename Container>
+    static size_t GetSize(const Container& c) {
+        if constexpr (type_utility::has_size<Container>) {
+            return static_cast<size_t>(c.size());
+        } else {
+            return static_cast<size_t>(std::distance(std::begin(c), std::end(c)));
+        }
+    }
+
+    static void Add(std::atomic<uint64_t>& counter, uint64_t n) {
+        counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    Algorithm algorithm_;
+    ThreadCounters& thread_;
+    Recorder* owner_;
+
+    uint64_t elements_{0};
+    bool early_exit_{false};
+    uint64_t result_elements_{0};
+    uint64_t scratch_elements_{0};
+};
+
+// AddVisits records that n elements were visited by the active algorithm of the thread, if any.
+inline void AddVisits(size_t n) {
+    if (auto* r = Recorder::Active()) {
+        r->AddVisits(n);
+    }
+}
+
+inline Snapshot GetSnapshot() {
+    return Registry::Get().GetSnapshot();
+}
+
+#else
+
+constexpr bool kEnabled = false;
+
+class Recorder {
+public:
+    explicit Recorder(Algorithm) {}
+
+    // The user-provided destructor keeps the compilers from warning about the recorders which are never used.
+    ~Recorder() {}
+
+    void AddVisits(size_t) {}
+
+    template <typename Container>
+    void VisitAll(const Container&) {}
+
+    void EarlyExit() {}
+
+    template <typename Container>
+    void SetResult(const Container&) {}
+
+    template <typename Container>
+    void AddScratch(const Container&) {}
+};
+
+inline void AddVisits(size_t) {}
+
+inline Snapshot GetSnapshot() {
+    return Snapshot{};
+}
+
+#endif  // LODASH_ENABLE_STATS
+
+}  // namespace lodash::stats
+
+#endif  // LODASH_STATS_H
@@ -0,0 +1,125 @@
+#ifndef LODASH_STREAM_H
+#define LODASH_STREAM_H
+
+#include <cstddef>
+#include <istream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./slice.h"
+#include "./type_check/has_func_args.h"
+#include "./type_utility/chunk_source.h"
+#include "./type_utility/parallel_for.h"
+#include "./type_utility/push_back_to_container.h"
+
+namespace lodash {
+
+// kDefaultChunkSize is the number of elements the chunked algorithms buffer by default. Larger chunks amortize the
+// per-chunk work of the callbacks, smaller ones bound the memory tighter.
+inline constexpr size_t kDefaultChunkSize = 4096;
+
+// FromIterators returns a chunk source reading [first, last), which may be a pair of single-pass input iterators.
+template <typename Iterator>
+inline auto FromIterators(Iterator first, Iterator last) {
+    return type_utility::IteratorSource<Iterator>(std::move(first), std::move(last));
+}
+
+// FromIstream returns a chunk source reading values of T from is with operator>>, until it fails.
+template <typename T>
+inline auto FromIstream(std::istream& is) {
+    return type_utility::IstreamSource<T>(is);
+}
+
+// FromGenerator returns a chunk source calling g, which returns a std::optional, until it returns std::nullopt.
+template <typename G>
+inline auto FromGenerator(G&& g) {
+    return type_utility::GeneratorSource<std::decay_t<G>>(std::forward<G>(g));
+}
+
+// The chunked algorithms pull the elements of a source, which need not fit in memory, in chunks of at most chunk_size
+// elements and only ever hold one chunk. The indexes passed to the callbacks are positions in the whole stream.
+
+// ForEachChunk invokes f with each chunk, a `std::vector<value_type>&` which is reused for the next chunk.
+template <typename Source, typename F>
+inline void ForEachChunk(Source&& source, F&& f, size_t chunk_size = kDefaultChunkSize) {
+    type_utility::VisitChunks(source, chunk_size, [&f](auto& chunk, size_t) {
+        f(chunk);
+    });
+}
+
+// MapChunks transforms the elements of each chunk with f and invokes sink with a `std::vector<R>&` of the results of
+// the chunk, R being the result type of f. The result buffer is reused as well.
+template <typename Source, typename F, typename Sink>
+inline void MapChunks(Source&& source, F&& f, Sink&& sink, size_t chunk_size = kDefaultChunkSize) {
+    using value_type = typename std::decay_t<Source>::value_type;
+    using result_type = std::decay_t<decltype(type_utility::InvokeWithIndex(f, std::declval<value_type&>(), 0))>;
+
+    auto res = std::vector<result_type>();
+    res.reserve(chunk_size);
+
+    type_utility::VisitChunks(source, chunk_size, [&](auto& chunk, size_t offset) {
+        res.clear();
+        for (size_t i = 0; i < chunk.size(); i++) {
+            type_utility::PushBackToContainer(res, type_utility::InvokeWithIndex(f, chunk[i], offset + i));
+        }
+
+        sink(res);
+    });
+}
+
+// FilterChunks invokes sink with each chunk once the elements predicate returns falsy for are erased from it, see
+// FilterInPlace. Chunks which end up empty are skipped.
+template <typename Source, typename F, typename Sink>
+inline void FilterChunks(Source&& source, F&& f, Sink&& sink, size_t chunk_size = kDefaultChunkSize) {
+    type_utility::VisitChunks(source, chunk_size, [&](auto& chunk, size_t offset) {
+        FilterInPlace(chunk, [&f, offset](auto& v, size_t ix) {
+            return type_utility::InvokeWithIndex(f, v, offset + ix);
+        });
+        if (!chunk.empty()) {
+            sink(chunk);
+        }
+    });
+}
+
+// ReduceChunks reduces the whole stream to a value like Reduce does with a container, the accumulator being carried
+// from a chunk to the next.
+template <typename Source, typename F, typename T>
+inline auto ReduceChunks(Source&& source, F&& f, T&& init, size_t chunk_size = kDefaultChunkSize) {
+    using value_type = typename std::decay_t<Source>::value_type;
+    using result_type = std::decay_t<T>;
+
+    auto res = result_type(std::forward<T>(init));
+
+    type_utility::VisitChunks(source, chunk_size, [&](auto& chunk, size_t offset) {
+        for (size_t i = 0; i < chunk.size(); i++) {
+            if constexpr (type_check::has_func_args_3<F&, result_type&, value_type&, size_t>) {
+                res = f(res, chunk[i], offset + i);
+            } else {
+                res = f(res, chunk[i]);
+            }
+        }
+    });
+
+    return res;
+}
+
+// CountByChunks counts the elements of the stream for which predicate is true.
+template <typename Source, typename F>
+inline size_t CountByChunks(Source&& source, F&& f, size_t chunk_size = kDefaultChunkSize) {
+    size_t count = 0;
+
+    type_utility::VisitChunks(source, chunk_size, [&](auto& chunk, size_t offset) {
+        for (size_t i = 0; i < chunk.size(); i++) {
+            if (type_utility::InvokeWithIndex(f, chunk[i], offset + i)) {
+                ++count;
+            }
+        }
+    });
+
+    return count;
+}
+
+}  // namespace lodash
+
+#endif  // LODASH_STREAM_H
@@ -1,55 +1,47 @@
 #ifndef LODASH_TYPES_CHECK_HAS_FUNC_ARGS_H
 #define LODASH_TYPES_CHECK_HAS_FUNC_ARGS_H
 
-#include <functional>
 #include <type_traits>
+#include <utility>
 
 namespace lodash::type_check {
 
-template <typename, typename T1, typename = void>
-constexpr bool has_func_args_1{};
-
-template <typename T, typename T1>
-constexpr bool has_func_args_1<T, T1, std::void_t<decltype(std::invoke(std::declval<T>(), std::declval<T1>()))>> = true;
-
-template <typename, typename T1, typename T2, typename = void>
-constexpr bool has_func_args_2{};
-
-template <typename T, typename T1, typename T2>
-constexpr bool
-        has_func_args_2<T,
-                        T1,
-                        T2,
-                        std::void_t<decltype(std::invoke(std::declval<T>(), std::declval<T1>(), std::declval<T2>()))>> =
-                true;
-
-template <typename, typename T1, typename T2, typename T3, typename = void>
-constexpr bool has_func_args_3{};
-
-template <typename T, typename T1, typename T2, typename T3>
-constexpr bool
-        has_func_args_3<T,
-                        T1,
-                        T2,
-                        T3,
-                        std::void_t<decltype(std::invoke(
-                                std::declval<T>(), std::declval<T1>(), std::declval<T2>(), std::declval<T3>()))>> =
-                true;
-
-template <typename, typename T1, typename T2, typename T3, typename T4, typename = void>
-constexpr bool has_func_args_4{};
-
-template <typename T, typename T1, typename T2, typename T3, typename T4>
-constexpr bool has_func_args_4<
-        T,
-        T1,
-        T2,
-        T3,
-        T4,
-        std::void_t<decltype(std::invoke(
-                std::declval<T>(), std::declval<T1>(), std::declval<T2>(), std::declval<T3>(), std::declval<T4>()))>> =
+// has_func_args<F, Args...> is whether an F can be called with Args, e.g. `has_func_args<F&, int&, size_t>`. The call
+// expression is checked directly rather than through std::invoke or std::is_invocable, whose machinery is instantiated
+// anew for each probe and dominates the compile time of the algorithms; the callbacks are never member pointers.
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+
+template <typename F, typename... Args>
+constexpr bool has_func_args = requires(F&& f, Args&&... args) {
+    static_cast<F&&>(f)(static_cast<Args&&>(args)...);
+};
+
+#else
+
+template <typename, typename F, typename... Args>
+constexpr bool has_func_args_probe{};
+
+template <typename F, typename... Args>
+constexpr bool has_func_args_probe<std::void_t<decltype(std::declval<F>()(std::declval<Args>()...))>, F, Args...> =
         true;
 
+template <typename F, typename... Args>
+constexpr bool has_func_args = has_func_args_probe<void, F, Args...>;
+
+#endif
+
+template <typename F, typename T1>
+constexpr bool has_func_args_1 = has_func_args<F, T1>;
+
+template <typename F, typename T1, typename T2>
+constexpr bool has_func_args_2 = has_func_args<F, T1, T2>;
+
+template <typename F, typename T1, typename T2, typename T3>
+constexpr bool has_func_args_3 = has_func_args<F, T1, T2, T3>;
+
+template <typename F, typename T1, typename T2, typename T3, typename T4>
+constexpr bool has_func_args_4 = has_func_args<F, T1, T2, T3, T4>;
+
 }  // namespace lodash::type_check
 
 #endif  // LODASH_TYPES_CHECK_HAS_FUNC_ARGS_H
@@ -0,0 +1,23 @@
+#ifndef LODASH_TYPES_CHECK_IS_CONTIGUOUS_H
+#define LODASH_TYPES_CHECK_IS_CONTIGUOUS_H
+
+#include <type_traits>
+
+namespace lodash::type_check {
+
+// is_contiguous checks whether the elements of a container are stored in one contiguous array, i.e. the container
+// exposes `data()` returning a pointer to its value_type and `size()`.
+template <typename, typename = void>
+constexpr bool is_contiguous{};
+
+template <typename T>
+constexpr bool is_contiguous<T,
+                             std::void_t<typename T::value_type,
+                                         decltype(std::declval<T&>().data()),
+                                         decltype(std::declval<T&>().size())> > =
+        std::is_same_v<std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<T&>().data())> >,
+                       typename T::value_type>;
+
+}  // namespace lodash::type_check
+
+#endif  // LODASH_TYPES_CHECK_IS_CONTIGUOUS_H
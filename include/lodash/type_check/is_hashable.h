@@ -0,0 +1,22 @@
+#ifndef LODASH_TYPES_CHECK_IS_HASHABLE_H
+#define LODASH_TYPES_CHECK_IS_HASHABLE_H
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace lodash::type_check {
+
+// is_hashable checks whether std::hash is enabled for T and T is equality comparable.
+template <typename, typename = void>
+constexpr bool is_hashable{};
+
+template <typename T>
+constexpr bool is_hashable<T,
+                           std::void_t<decltype(std::declval<const std::hash<T>&>()(std::declval<const T&>())),
+                                       decltype(std::declval<const T&>() == std::declval<const T&>())> > =
+        std::is_default_constructible_v<std::hash<T> >;
+
+}  // namespace lodash::type_check
+
+#endif  // LODASH_TYPES_CHECK_IS_HASHABLE_H
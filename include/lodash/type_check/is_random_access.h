@@ -0,0 +1,19 @@
+#ifndef LODASH_TYPES_CHECK_IS_RANDOM_ACCESS_H
+#define LODASH_TYPES_CHECK_IS_RANDOM_ACCESS_H
+
+#include <iterator>
+#include <type_traits>
+
+namespace lodash::type_check {
+
+template <typename, typename = void>
+constexpr bool is_random_access{};
+
+template <typename T>
+constexpr bool is_random_access<T, std::void_t<decltype(std::begin(std::declval<T&>()))> > =
+        std::is_base_of_v<std::random_access_iterator_tag,
+                          typename std::iterator_traits<decltype(std::begin(std::declval<T&>()))>::iterator_category>;
+
+}  // namespace lodash::type_check
+
+#endif  // LODASH_TYPES_CHECK_IS_RANDOM_ACCESS_H
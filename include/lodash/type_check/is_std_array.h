@@ -0,0 +1,18 @@
+#ifndef LODASH_TYPES_CHECK_IS_STD_ARRAY_H
+#define LODASH_TYPES_CHECK_IS_STD_ARRAY_H
+
+#include <array>
+#include <cstddef>
+
+namespace lodash::type_check {
+
+// is_std_array checks whether T is a std::array, whose size is part of its type.
+template <typename>
+constexpr bool is_std_array{};
+
+template <typename T, size_t N>
+constexpr bool is_std_array<std::array<T, N> > = true;
+
+}  // namespace lodash::type_check
+
+#endif  // LODASH_TYPES_CHECK_IS_STD_ARRAY_H
@@ -0,0 +1,153 @@
+#ifndef LODASH_TYPE_UTILITY_ACCUMULATE_H
+#define LODASH_TYPE_UTILITY_ACCUMULATE_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../simd/sum.h"
+#include "../type_check/is_contiguous.h"
+
+namespace lodash::type_utility {
+
+// Identity is the projection of Sum, Sum is SumBy with Identity.
+struct Identity {
+    template <typename T>
+    constexpr T&& operator()(T&& t) const {
+        return std::forward<T>(t);
+    }
+};
+
+// sum_result_t is the accumulator type of Sum / SumBy: R if the caller chose one, otherwise the value_type of the
+// container if it is arithmetic and the result type of f if it is not.
+template <typename R, typename Container, typename F>
+using sum_result_t = std::conditional_t<
+        !std::is_void_v<R>,
+        R,
+        std::conditional_t<std::is_arithmetic_v<typename std::decay_t<Container>::value_type>,
+                           typename std::decay_t<Container>::value_type,
+                           std::decay_t<std::invoke_result_t<F&, typename std::decay_t<Container>::value_type&>>>>;
+
+// Accumulate adds up f(v) for the values of the container into R from left to right. It can be evaluated at compile
+// time.
+template <typename R, typename Container, typename F>
+constexpr R Accumulate(Container& c, F& f) {
+    auto res = R();
+    for (auto&& v : c) {
+        res += f(v);
+    }
+
+    return res;
+}
+
+// kPairwiseBlockSize is the number of values AccumulatePairwise adds up with the plain kernels before adding the blocks
+// pairwise. It amortizes the pairwise steps while keeping the error of a block small.
+inline constexpr size_t kPairwiseBlockSize = 512;
+
+// PairwiseSum adds up the sums of consecutive blocks in a balanced binary tree, keeping one partial sum per level like
+// a binary counter, so the rounding error grows with the logarithm of the number of blocks instead of linearly.
+template <typename R>
+class PairwiseSum {
+public:
+    void Add(R block) {
+        size_t level = 0;
+        for (; (count_ >> level) & 1; level++) {
+            block = levels_[level] + block;
+        }
+
+        levels_[level] = block;
+        ++count_;
+    }
+
+    // Get returns the sum of the blocks, the partial sums are added from the smallest to the largest.
+    R Get() const {
+        auto res = R();
+        for (size_t level = 0; level < levels_.size(); level++) {
+            if ((count_ >> level) & 1) {
+                res = levels_[level] + res;
+            }
+        }
+
+        return res;
+    }
+
+private:
+    std::array<R, sizeof(size_t) * 8> levels_{};
+    size_t count_{0};
+};
+
+// AccumulatePairwise adds up f(v) for the values of the container with blocked pairwise summation into R. Contiguous
+// containers of arithmetic values are summed block by block with the kernels of simd/sum.h.
+template <typename R, typename Container, typename F>
+inline R AccumulatePairwise(Container& c, F& f) {
+    using value_type = typename std::decay_t<Container>::value_type;
+
+    auto res = PairwiseSum<R>();
+
+    if constexpr (type_check::is_contiguous<std::decay_t<Container>> && std::is_arithmetic_v<value_type> &&
+                  !std::is_same_v<value_type, bool>) {
+        auto* p = c.data();
+        auto n = static_cast<size_t>(c.size());
+
+        for (size_t i = 0; i < n; i += kPairwiseBlockSize) {
+            auto block_size = std::min(kPairwiseBlockSize, n - i);
+
+            if constexpr (std::is_same_v<std::decay_t<F>, Identity> && std::is_same_v<R, value_type>) {
+                res.Add(simd::Sum(p + i, block_size));
+            } else {
+                res.Add(simd::SumBy<R>(p + i, block_size, f));
+            }
+        }
+    } else {
+        auto block = R();
+        size_t block_size = 0;
+
+        for (auto&& v : c) {
+            block += f(v);
+
+            if (++block_size == kPairwiseBlockSize) {
+                res.Add(block);
+                block = R();
+                block_size = 0;
+            }
+        }
+
+        if (block_size > 0) {
+            res.Add(block);
+        }
+    }
+
+    return res.Get();
+}
+
+// AccumulateKahan adds up f(v) for the values of the container into R with Neumaier's variant of Kahan summation: the
+// rounding error of every addition is carried in a compensation term, so the result is accurate to a few ulps whatever
+// the number and the order of the values. It is sequential, and only meaningful without -ffast-math.
+template <typename R, typename Container, typename F>
+inline R AccumulateKahan(Container& c, F& f) {
+    static_assert(std::is_floating_point_v<R>, "Kahan summation needs a floating-point accumulator");
+
+    auto sum = R();
+    auto compensation = R();
+
+    for (auto&& v : c) {
+        auto x = static_cast<R>(f(v));
+        auto t = sum + x;
+
+        if ((sum >= 0 ? sum : -sum) >= (x >= 0 ? x : -x)) {
+            compensation += (sum - t) + x;
+        } else {
+            compensation += (x - t) + sum;
+        }
+
+        sum = t;
+    }
+
+    return sum + compensation;
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_ACCUMULATE_H
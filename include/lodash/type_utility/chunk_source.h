@@ -0,0 +1,119 @@
+#ifndef LODASH_TYPE_UTILITY_CHUNK_SOURCE_H
+#define LODASH_TYPE_UTILITY_CHUNK_SOURCE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lodash::type_utility {
+
+// The chunk sources produce the elements of a stream which is not materialized as a container. Read appends at most n
+// elements to chunk and returns how many it appended, fewer than n only once the source is exhausted.
+
+// IteratorSource reads [first, last) once, so single-pass input iterators such as std::istream_iterator are supported.
+template <typename Iterator>
+class IteratorSource {
+public:
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+    IteratorSource(Iterator first, Iterator last) : first_(std::move(first)), last_(std::move(last)) {}
+
+    size_t Read(std::vector<value_type>& chunk, size_t n) {
+        size_t k = 0;
+        for (; k < n && first_ != last_; ++k, ++first_) {
+            chunk.push_back(*first_);
+        }
+
+        return k;
+    }
+
+private:
+    Iterator first_;
+    Iterator last_;
+};
+
+// IstreamSource reads values of T with operator>> until the stream fails, like std::istream_iterator<T>.
+template <typename T>
+class IstreamSource {
+public:
+    using value_type = T;
+
+    explicit IstreamSource(std::istream& is) : is_(is) {}
+
+    size_t Read(std::vector<value_type>& chunk, size_t n) {
+        size_t k = 0;
+        for (auto v = T(); k < n && is_ >> v; ++k) {
+            chunk.push_back(std::move(v));
+        }
+
+        return k;
+    }
+
+private:
+    std::istream& is_;
+};
+
+// GeneratorSource calls a generator returning std::optional<T> until it returns std::nullopt, and never after.
+template <typename G>
+class GeneratorSource {
+public:
+    using value_type = typename std::invoke_result_t<G&>::value_type;
+
+    explicit GeneratorSource(G g) : g_(std::move(g)) {}
+
+    size_t Read(std::vector<value_type>& chunk, size_t n) {
+        size_t k = 0;
+        for (; k < n && !done_; ++k) {
+            auto v = g_();
+            if (!v.has_value()) {
+                done_ = true;
+                break;
+            }
+
+            chunk.push_back(std::move(*v));
+        }
+
+        return k;
+    }
+
+private:
+    G g_;
+    bool done_{false};
+};
+
+// VisitChunks reads the source in chunks of chunk_size elements and invokes `f(chunk, offset)` for each non-empty
+// chunk, offset being the index of its first element in the stream. The chunk buffer is allocated once and reused,
+// so the memory is bounded by chunk_size elements whatever the length of the stream. f may modify the chunk.
+template <typename Source, typename F>
+inline void VisitChunks(Source& source, size_t chunk_size, F&& f) {
+    chunk_size = std::max<size_t>(chunk_size, 1);
+
+    auto chunk = std::vector<typename Source::value_type>();
+    chunk.reserve(chunk_size);
+
+    size_t offset = 0;
+    for (;;) {
+        chunk.clear();
+
+        auto n = source.Read(chunk, chunk_size);
+        if (n == 0) {
+            return;
+        }
+
+        f(chunk, offset);
+        offset += n;
+
+        if (n < chunk_size) {
+            return;
+        }
+    }
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_CHUNK_SOURCE_H
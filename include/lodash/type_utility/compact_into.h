@@ -0,0 +1,51 @@
+#ifndef LODASH_TYPE_UTILITY_COMPACT_INTO_H
+#define LODASH_TYPE_UTILITY_COMPACT_INTO_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../simd/compact.h"
+#include "../type_check/has_func_args.h"
+#include "../type_check/is_contiguous.h"
+#include "./reserve_container.h"
+
+namespace lodash::type_utility {
+
+template <typename, typename = void>
+constexpr bool has_resize{};
+
+template <typename T>
+constexpr bool has_resize<T, std::void_t<decltype(std::declval<T&>().resize(size_t(1)))> > = true;
+
+// use_compaction checks whether filtering a Container with the predicate F into R can go through simd::CompactBy:
+// both are contiguous with the same trivially copyable value_type, R can be resized, and F takes a value only.
+template <typename R, typename Container, typename F, typename = void>
+constexpr bool use_compaction{};
+
+template <typename R, typename Container, typename F>
+constexpr bool use_compaction<R,
+                              Container,
+                              F,
+                              std::enable_if_t<type_check::is_contiguous<std::decay_t<Container> > &&
+                                               type_check::is_contiguous<R> > > =
+        std::is_same_v<typename std::decay_t<Container>::value_type, typename R::value_type> &&
+        std::is_trivially_copyable_v<typename R::value_type> && has_resize<R> &&
+        !type_check::has_func_args_2<F, typename R::value_type&, size_t> &&
+        type_check::has_func_args_1<F, typename R::value_type&>;
+
+// use_compaction_into checks whether Filter can compact into a result R: CompactInto sizes R for the whole input first,
+// which a container with inline storage would allocate for however few elements are kept.
+template <typename R, typename Container, typename F>
+constexpr bool use_compaction_into = use_compaction<R, Container, F> && !has_inline_capacity<R>;
+
+// CompactInto appends the values of p[0, n) for which `bool(f(value)) == keep` to res.
+template <typename R, typename V, typename F>
+inline void CompactInto(R& res, const V* p, size_t n, F& f, bool keep) {
+    auto offset = res.size();
+    res.resize(offset + n);
+    res.resize(offset + simd::CompactBy(p, n, res.data() + offset, f, keep));
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_COMPACT_INTO_H
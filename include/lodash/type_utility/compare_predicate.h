@@ -0,0 +1,52 @@
+#ifndef LODASH_TYPE_UTILITY_COMPARE_PREDICATE_H
+#define LODASH_TYPE_UTILITY_COMPARE_PREDICATE_H
+
+#include <type_traits>
+
+namespace lodash::type_utility {
+
+enum class CompareOp {
+    kEq,
+    kNe,
+    kLt,
+    kLte,
+    kGt,
+    kGte,
+};
+
+// ComparePredicate compares its argument with a fixed value. Unlike a lambda its operation is visible in its type,
+// which lets the compaction kernels evaluate it with vector comparisons.
+template <CompareOp Op, typename T>
+struct ComparePredicate {
+    using value_type = T;
+    static constexpr CompareOp kOp = Op;
+
+    T value;
+
+    template <typename U>
+    constexpr bool operator()(const U& x) const {
+        if constexpr (Op == CompareOp::kEq) {
+            return x == value;
+        } else if constexpr (Op == CompareOp::kNe) {
+            return x != value;
+        } else if constexpr (Op == CompareOp::kLt) {
+            return x < value;
+        } else if constexpr (Op == CompareOp::kLte) {
+            return x <= value;
+        } else if constexpr (Op == CompareOp::kGt) {
+            return x > value;
+        } else {
+            return x >= value;
+        }
+    }
+};
+
+template <typename T>
+constexpr bool is_compare_predicate_v{};
+
+template <CompareOp Op, typename T>
+constexpr bool is_compare_predicate_v<ComparePredicate<Op, T> > = true;
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_COMPARE_PREDICATE_H
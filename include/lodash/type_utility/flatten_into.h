@@ -0,0 +1,49 @@
+#ifndef LODASH_TYPE_UTILITY_FLATTEN_INTO_H
+#define LODASH_TYPE_UTILITY_FLATTEN_INTO_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../type_check/is_iterable.h"
+#include "./forward_element.h"
+#include "./get_flatten_container_value_type.h"
+#include "./get_size_hint.h"
+#include "./push_back_to_container.h"
+
+namespace lodash::type_utility {
+
+// GetFlattenSize returns the number of elements of a nested container once Depth levels of it are flattened, only the
+// innermost flattened containers are measured with size() so the cost is linear in the number of inner containers.
+// Inner containers without size() count as 0, which makes the result a lower bound.
+template <size_t Depth = kFlattenFullDepth, typename Container>
+inline size_t GetFlattenSize(const Container& c) {
+    using value_type = typename std::decay_t<Container>::value_type;
+
+    if constexpr (Depth > 0 && type_check::is_iterable<value_type>) {
+        size_t res = 0;
+        for (auto&& v : c) {
+            res += GetFlattenSize<Depth - 1>(v);
+        }
+
+        return res;
+    } else {
+        return GetSizeHint(c);
+    }
+}
+
+// FlattenInto appends the elements of a nested container, Depth levels of it flattened, to res in order, without
+// building intermediate containers for the inner levels. The elements of an rvalue container are moved.
+template <size_t Depth = kFlattenFullDepth, typename R, typename Container>
+inline void FlattenInto(R& res, Container&& c) {
+    for (auto&& v : c) {
+        if constexpr (Depth > 0 && type_check::is_iterable<std::decay_t<decltype(v)>>) {
+            FlattenInto<Depth - 1>(res, ForwardElement<Container>(v));
+        } else {
+            PushBackToContainer(res, ForwardElement<Container>(v));
+        }
+    }
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_FLATTEN_INTO_H
@@ -0,0 +1,17 @@
+#ifndef LODASH_TYPE_UTILITY_FORWARD_ELEMENT_H
+#define LODASH_TYPE_UTILITY_FORWARD_ELEMENT_H
+
+#include <type_traits>
+
+namespace lodash::type_utility {
+
+// ForwardElement casts an element of a container passed as `Container&&` to an rvalue if the container is an rvalue,
+// so that the elements of a container the caller gave away are moved instead of copied.
+template <typename Container, typename V>
+constexpr auto ForwardElement(V& v) -> std::conditional_t<std::is_lvalue_reference_v<Container>, V&, V&&> {
+    return static_cast<std::conditional_t<std::is_lvalue_reference_v<Container>, V&, V&&>>(v);
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_FORWARD_ELEMENT_H
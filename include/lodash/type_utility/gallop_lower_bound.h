@@ -0,0 +1,35 @@
+#ifndef LODASH_TYPE_UTILITY_GALLOP_LOWER_BOUND_H
+#define LODASH_TYPE_UTILITY_GALLOP_LOWER_BOUND_H
+
+#include <algorithm>
+#include <iterator>
+
+namespace lodash::type_utility {
+
+// GallopLowerBound returns the first position in the sorted random-access range [first, last) which is not less than
+// value. It probes first + 1, first + 3, first + 7, ... before a binary search inside the last bracket, so it costs
+// O(log d) comparisons where d is the distance to the result instead of O(log (last - first)).
+template <typename It, typename T, typename Compare>
+inline It GallopLowerBound(It first, It last, const T& value, Compare& comp) {
+    using difference_type = typename std::iterator_traits<It>::difference_type;
+
+    auto n = last - first;
+    difference_type lo = 0;
+    difference_type step = 1;
+
+    while (lo < n && comp(first[lo], value)) {
+        auto hi = lo + step;
+        if (hi >= n || !comp(first[hi], value)) {
+            return std::lower_bound(first + lo + 1, first + std::min(hi, n), value, comp);
+        }
+
+        lo = hi + 1;
+        step *= 2;
+    }
+
+    return first + std::min(lo, n);
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_GALLOP_LOWER_BOUND_H
@@ -1,27 +1,51 @@
 #ifndef LODASH_TYPE_UTILITY_GET_FLATTEN_CONTAINER_VALUE_TYPE_H
 #define LODASH_TYPE_UTILITY_GET_FLATTEN_CONTAINER_VALUE_TYPE_H
 
+#include <cstddef>
+#include <type_traits>
+
 #include "../type_check/is_iterable.h"
 
 namespace lodash::type_utility {
 
+// kFlattenFullDepth is the depth which flattens all the levels of a nested container.
+inline constexpr size_t kFlattenFullDepth = static_cast<size_t>(-1);
+
+// type_identity carries a type out of the functions below, like C++20's std::type_identity.
+template <typename T>
+struct type_identity {
+    using type = T;
+};
+
 template <typename T>
 inline constexpr auto get_flatten_container_value_type() {
     if constexpr (type_check::is_iterable<T>) {
         using value_type = typename std::decay_t<T>::value_type;
         return get_flatten_container_value_type<value_type>();
     } else {
-        struct _ {
-            using type = T;
-        };
-
-        return _{};
+        return type_identity<T>{};
     }
 }
 
 template <typename T>
 using get_flatten_container_value_type_t = typename decltype(get_flatten_container_value_type<T>())::type;
 
+// get_flatten_depth_value_type_t is the element type of Container once Depth levels of it are flattened, e.g.
+// std::vector<int> for std::vector<std::vector<std::vector<int>>> and a depth of 1.
+template <typename Container, size_t Depth>
+inline constexpr auto get_flatten_depth_value_type() {
+    using value_type = typename std::decay_t<Container>::value_type;
+
+    if constexpr (Depth > 0 && type_check::is_iterable<value_type>) {
+        return get_flatten_depth_value_type<value_type, Depth - 1>();
+    } else {
+        return type_identity<value_type>{};
+    }
+}
+
+template <typename Container, size_t Depth>
+using get_flatten_depth_value_type_t = typename decltype(get_flatten_depth_value_type<Container, Depth>())::type;
+
 }  // namespace lodash::type_utility
 
 #endif  // LODASH_TYPE_UTILITY_GET_FLATTEN_CONTAINER_VALUE_TYPE_H
@@ -0,0 +1,27 @@
+#ifndef LODASH_TYPE_UTILITY_GET_SIZE_HINT_H
+#define LODASH_TYPE_UTILITY_GET_SIZE_HINT_H
+
+#include <cstddef>
+#include <type_traits>
+
+namespace lodash::type_utility {
+
+template <typename, typename = void>
+constexpr bool has_size{};
+
+template <typename T>
+constexpr bool has_size<T, std::void_t<decltype(std::declval<const T&>().size())> > = true;
+
+// GetSizeHint returns the number of elements of the container if it is known in O(1), otherwise 0.
+template <typename Container>
+inline size_t GetSizeHint(const Container& c) {
+    if constexpr (has_size<Container>) {
+        return static_cast<size_t>(c.size());
+    } else {
+        return 0;
+    }
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_GET_SIZE_HINT_H
@@ -0,0 +1,72 @@
+#ifndef LODASH_TYPE_UTILITY_IOTA_H
+#define LODASH_TYPE_UTILITY_IOTA_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace lodash::type_utility {
+
+// IotaSize returns the number of values of the range from start up to, but not including, stop by step: 0 if step is 0
+// or steps away from stop. For an unsigned T, the step of a descending range is taken modulo 2^N, e.g. T(-1) steps
+// down by 1 as it does for a signed T. It can be evaluated at compile time for integers.
+template <typename T>
+constexpr size_t IotaSize(T start, T stop, T step) {
+    if (start == stop || step == T(0)) {
+        return 0;
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+        if (!(start < stop && step > 0) && !(start > stop && step < 0)) {
+            return 0;
+        }
+
+        return static_cast<size_t>(std::ceil((stop - start) / step));
+    } else {
+        // The distances are computed in 64-bit unsigned arithmetic, which neither overflows nor truncates them.
+        uint64_t distance = 0;
+        uint64_t magnitude = 0;
+
+        if (start < stop) {
+            if constexpr (std::is_signed_v<T>) {
+                if (step < 0) {
+                    return 0;
+                }
+            }
+
+            distance = uint64_t(stop) - uint64_t(start);
+            magnitude = uint64_t(step);
+        } else {
+            if constexpr (std::is_signed_v<T>) {
+                if (step > 0) {
+                    return 0;
+                }
+
+                magnitude = uint64_t(0) - uint64_t(step);
+            } else {
+                magnitude = uint64_t(T(T(0) - step));
+            }
+
+            distance = uint64_t(start) - uint64_t(stop);
+        }
+
+        return static_cast<size_t>(distance / magnitude + (distance % magnitude != 0));
+    }
+}
+
+// IotaValue returns the i-th value of the range from start by step. The integers wrap around like unsigned integers,
+// which gives the right value whenever it lies between start and stop. The floating point values are computed from i
+// rather than by adding up the steps, so their error does not grow along the range.
+template <typename T>
+constexpr T IotaValue(T start, T step, size_t i) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return start + static_cast<T>(i) * step;
+    } else {
+        return static_cast<T>(uint64_t(start) + uint64_t(i) * uint64_t(step));
+    }
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_IOTA_H
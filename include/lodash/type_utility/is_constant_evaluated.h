@@ -0,0 +1,31 @@
+#ifndef LODASH_TYPE_UTILITY_IS_CONSTANT_EVALUATED_H
+#define LODASH_TYPE_UTILITY_IS_CONSTANT_EVALUATED_H
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define LODASH_HAS_IS_CONSTANT_EVALUATED 1
+#endif
+#endif
+
+#if !defined(LODASH_HAS_IS_CONSTANT_EVALUATED) && \
+        ((defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925))
+#define LODASH_HAS_IS_CONSTANT_EVALUATED 1
+#endif
+
+namespace lodash::type_utility {
+
+// IsConstantEvaluated returns whether it is called during a constant evaluation, like C++20
+// std::is_constant_evaluated. The algorithms which support constant evaluation take a plain scalar path then and
+// their vectorized and instrumented path at run time. Without the compiler builtin it always returns false, and the
+// algorithms cannot be evaluated at compile time.
+constexpr bool IsConstantEvaluated() {
+#ifdef LODASH_HAS_IS_CONSTANT_EVALUATED
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_IS_CONSTANT_EVALUATED_H
@@ -0,0 +1,56 @@
+#ifndef LODASH_TYPE_UTILITY_MAP_ARRAY_H
+#define LODASH_TYPE_UTILITY_MAP_ARRAY_H
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "../container/static_vector.h"
+#include "./get_result_type.h"
+#include "./visit_container.h"
+
+namespace lodash::type_utility {
+
+// The std::array counterparts of Map and Filter build results whose capacity is known at compile time, so they can be
+// evaluated in constant expressions, e.g. to compute lookup tables.
+
+// MapArray returns a std::array of the results of f for the elements of a std::array, the result type of f must be
+// default constructible.
+template <typename Container, typename F>
+constexpr auto MapArray(Container& c, F& f) {
+    using result_type = get_result_type_t<Container, F>;
+
+    auto res = std::array<result_type, std::tuple_size_v<std::decay_t<Container>>>{};
+    size_t ix = 0;
+
+    VisitContainer(c, f, [&res, &ix](auto&& r, [[maybe_unused]] auto&& value, [[maybe_unused]] auto&& node_info) {
+        res[ix++] = r;
+        return ReturnInfo{};
+    });
+
+    return res;
+}
+
+// FilterArray returns a container::StaticVector with the capacity of a std::array of its elements which predicate
+// returns truthy for.
+template <typename Container, typename F>
+constexpr auto FilterArray(Container& c, F& f) {
+    using value_type = typename std::decay_t<Container>::value_type;
+
+    auto res = container::StaticVector<value_type, std::tuple_size_v<std::decay_t<Container>>>();
+
+    VisitContainer(c, f, [&res](auto&& r, auto&& value, [[maybe_unused]] auto&& node_info) {
+        if (r) {
+            res.push_back(value);
+        }
+
+        return ReturnInfo{};
+    });
+
+    return res;
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_MAP_ARRAY_H
@@ -0,0 +1,106 @@
+#ifndef LODASH_TYPE_UTILITY_MEMORY_RESOURCE_H
+#define LODASH_TYPE_UTILITY_MEMORY_RESOURCE_H
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../container/static_vector.h"
+
+namespace lodash::type_utility {
+
+// DefaultResource makes an algorithm allocate its result and scratch structures with their default allocators,
+// it is what the overloads without a memory resource use.
+struct DefaultResource {};
+
+template <typename T>
+constexpr bool is_default_resource_v = std::is_same_v<std::decay_t<T>, DefaultResource>;
+
+// is_resource_v accepts DefaultResource and anything convertible to `std::pmr::memory_resource*`.
+template <typename T>
+constexpr bool is_resource_v = is_default_resource_v<T> || std::is_convertible_v<T, std::pmr::memory_resource*>;
+
+template <typename, typename = void>
+constexpr bool is_allocator{};
+
+template <typename T>
+constexpr bool is_allocator<T, std::void_t<typename T::value_type, decltype(std::declval<T&>().allocate(size_t(1)))> > =
+        true;
+
+template <template <typename...> class C, typename Args, typename Seq>
+struct rebind_last_to_pmr;
+
+template <template <typename...> class C, typename... Args, size_t... I>
+struct rebind_last_to_pmr<C, std::tuple<Args...>, std::index_sequence<I...> > {
+    using args = std::tuple<Args...>;
+    using allocator_type = std::tuple_element_t<sizeof...(Args) - 1, args>;
+
+    using type = C<std::tuple_element_t<I, args>...,
+                   std::pmr::polymorphic_allocator<typename std::allocator_traits<allocator_type>::value_type> >;
+};
+
+// rebind_pmr replaces the allocator of a standard container with std::pmr::polymorphic_allocator,
+// e.g. std::vector<int> becomes std::pmr::vector<int> and std::string becomes std::pmr::string.
+// Types whose last template argument is not an allocator are left unchanged.
+template <typename Container, typename = void>
+struct rebind_pmr {
+    using type = Container;
+};
+
+template <template <typename...> class C, typename... Args>
+struct rebind_pmr<C<Args...>,
+                  std::enable_if_t<(sizeof...(Args) > 0) &&
+                                   is_allocator<std::tuple_element_t<sizeof...(Args) - 1, std::tuple<Args...> > > > > {
+    using type =
+            typename rebind_last_to_pmr<C, std::tuple<Args...>, std::make_index_sequence<sizeof...(Args) - 1> >::type;
+};
+
+template <typename Container>
+using rebind_pmr_t = typename rebind_pmr<Container>::type;
+
+// result_container_t is the container the algorithms build from elements of Container: Container itself, or its
+// `result_container` member type for the read-only containers which cannot be built, e.g. container::MappedArray.
+// A std::array, which cannot grow, gives a container::StaticVector of the same capacity.
+template <typename Container, typename = void>
+struct result_container {
+    using type = Container;
+};
+
+template <typename Container>
+struct result_container<Container, std::void_t<typename Container::result_container> > {
+    using type = typename Container::result_container;
+};
+
+template <typename T, size_t N>
+struct result_container<std::array<T, N> > {
+    using type = container::StaticVector<T, N>;
+};
+
+template <typename Container>
+using result_container_t = typename result_container<Container>::type;
+
+// rebind_container_t is the result container of an algorithm called with Resource: the result container of Container
+// for DefaultResource, its pmr counterpart otherwise.
+template <typename Container, typename Resource>
+using rebind_container_t = std::conditional_t<is_default_resource_v<Resource>,
+                                              result_container_t<Container>,
+                                              rebind_pmr_t<result_container_t<Container> > >;
+
+// MakeContainer returns an empty R which allocates from the resource if R is allocator-aware.
+template <typename R, typename Resource>
+inline R MakeContainer([[maybe_unused]] Resource resource) {
+    if constexpr (!is_default_resource_v<Resource> &&
+                  std::uses_allocator_v<R, std::pmr::polymorphic_allocator<std::byte> >) {
+        return R(typename R::allocator_type(static_cast<std::pmr::memory_resource*>(resource)));
+    } else {
+        return R();
+    }
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_MEMORY_RESOURCE_H
@@ -0,0 +1,78 @@
+#ifndef LODASH_TYPE_UTILITY_PARALLEL_FOR_H
+#define LODASH_TYPE_UTILITY_PARALLEL_FOR_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "../execution.h"
+#include "../executor.h"
+#include "../type_check/has_func_args.h"
+
+namespace lodash::type_utility {
+
+// GetExecutor returns the executor which runs the chunks under the policy.
+inline Executor& GetExecutor(const execution::ParallelPolicy& policy) {
+    return policy.executor != nullptr ? *policy.executor : Executor::Default();
+}
+
+// GetChunkCount returns the number of chunks an input of size n is split into under the policy.
+// The result only depends on n, the policy and the concurrency of its executor, so the chunk boundaries are
+// deterministic.
+inline size_t GetChunkCount(const execution::ParallelPolicy& policy, size_t n) {
+    if (n == 0) {
+        return 0;
+    }
+
+    auto max_chunks = policy.max_concurrency;
+    if (max_chunks == 0) {
+        max_chunks = GetExecutor(policy).Concurrency();
+    }
+
+    auto grain_size = std::max<size_t>(policy.grain_size, 1);
+    return std::min((n + grain_size - 1) / grain_size, max_chunks);
+}
+
+// GetChunkBegin returns the first index of the chunk_ix-th chunk when [0, n) is split evenly into chunk_count chunks.
+inline size_t GetChunkBegin(size_t chunk_ix, size_t chunk_count, size_t n) {
+    return n / chunk_count * chunk_ix + std::min(chunk_ix, n % chunk_count);
+}
+
+// ParallelForChunks splits [0, n) into chunk_count chunks and invokes `f(chunk_ix, begin, end)` for each of them on
+// the executor of the policy. The first exception thrown by any chunk is rethrown after all chunks have finished.
+template <typename F>
+inline void ParallelForChunks(const execution::ParallelPolicy& policy, size_t chunk_count, size_t n, F&& f) {
+    GetExecutor(policy).ParallelFor(chunk_count, [&f, chunk_count, n](size_t chunk_ix) {
+        f(chunk_ix, GetChunkBegin(chunk_ix, chunk_count, n), GetChunkBegin(chunk_ix + 1, chunk_count, n));
+    });
+}
+
+// CombineTree combines the partial results of the chunks pairwise in a balanced tree, e.g.
+// `combine(combine(combine(p0, p1), combine(p2, p3)), p4)` for 5 parts. The shape of the tree only depends on the
+// number of parts, so floating-point results are reproducible for a given chunking. parts must not be empty, its
+// elements are moved from.
+template <typename T, typename F>
+inline T CombineTree(std::vector<T>& parts, F& combine) {
+    for (size_t stride = 1; stride < parts.size(); stride *= 2) {
+        for (size_t i = 0; i + stride < parts.size(); i += 2 * stride) {
+            parts[i] = combine(std::move(parts[i]), std::move(parts[i + stride]));
+        }
+    }
+
+    return std::move(parts[0]);
+}
+
+// InvokeWithIndex invokes f with an element of a sequence container and its index, following the same argument
+// dispatch as VisitContainer. The element may be a prvalue, which the iterators computing their values return.
+template <typename F, typename V>
+inline decltype(auto) InvokeWithIndex(F& f, V&& v, size_t ix) {
+    if constexpr (type_check::has_func_args_2<F&, V&, size_t>) {
+        return f(v, ix);
+    } else {
+        return f(v);
+    }
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_PARALLEL_FOR_H
@@ -1,21 +1,29 @@
 #ifndef LODASH_TYPE_UTILITY_PUSH_BACK_TO_CONTAINER_H
 #define LODASH_TYPE_UTILITY_PUSH_BACK_TO_CONTAINER_H
 
-#include <string>
 #include <type_traits>
 
 #include "../type_check/is_map.h"
 
 namespace lodash::type_utility {
 
+template <typename, typename T, typename = void>
+constexpr bool has_emplace_back{};
+
+template <typename Container, typename T>
+constexpr bool has_emplace_back<Container,
+                                T,
+                                std::void_t<decltype(std::declval<Container&>().emplace_back(std::declval<T>()))> > =
+        true;
+
 template <typename Container, typename T>
-inline void PushBackToContainer(Container&& c, T&& t) {
+constexpr void PushBackToContainer(Container&& c, T&& t) {
     if constexpr (type_check::is_map<std::decay_t<Container>>) {
         c.emplace(std::forward<T>(t));
-    } else if constexpr (std::is_same_v<std::decay_t<Container>, std::string>) {
-        c.push_back(t);
-    } else {
+    } else if constexpr (has_emplace_back<std::decay_t<Container>, T>) {
         c.emplace_back(std::forward<T>(t));
+    } else {
+        c.push_back(std::forward<T>(t));
     }
 }
 
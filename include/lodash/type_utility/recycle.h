@@ -0,0 +1,33 @@
+#ifndef LODASH_TYPE_UTILITY_RECYCLE_H
+#define LODASH_TYPE_UTILITY_RECYCLE_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+
+#include "./memory_resource.h"
+
+namespace lodash::type_utility {
+
+// is_recyclable_v checks whether an algorithm returning R may build its result in the storage of its input, i.e.
+// the input is a non-const rvalue of type R which the caller gives away.
+template <typename R, typename Container>
+constexpr bool is_recyclable_v = !std::is_lvalue_reference_v<Container> &&
+                                 !std::is_const_v<std::remove_reference_t<Container> > &&
+                                 std::is_same_v<R, std::remove_reference_t<Container> >;
+
+// CanRecycle checks whether the storage of c allocates from the resource the result was asked to allocate from.
+// Without an explicit resource the storage of an rvalue input is always reused.
+template <typename Container, typename Resource>
+inline bool CanRecycle([[maybe_unused]] const Container& c, [[maybe_unused]] Resource resource) {
+    if constexpr (!is_default_resource_v<Resource> &&
+                  std::uses_allocator_v<Container, std::pmr::polymorphic_allocator<std::byte> >) {
+        return c.get_allocator().resource()->is_equal(*static_cast<std::pmr::memory_resource*>(resource));
+    } else {
+        return true;
+    }
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_RECYCLE_H
@@ -2,16 +2,20 @@
 #define LODASH_TYPE_UTILITY_REDUCE_HANDLER_H
 
 #include <type_traits>
+#include <utility>
+
+#include "../type_check/has_func_args.h"
 
 namespace lodash::type_utility {
 
 template <typename F, typename T>
 class ReduceHandler {
 public:
-    ReduceHandler(F&& f, T&& t) : f_(f), t_(t) {}
+    template <typename Fn, typename U>
+    ReduceHandler(Fn&& f, U&& t) : f_(std::forward<Fn>(f)), t_(std::forward<U>(t)) {}
 
     template <typename... Args,
-              std::enable_if_t<std::is_void_v<std::void_t<std::result_of_t<F(std::decay_t<T>, Args...)>>>, bool> = true>
+              std::enable_if_t<type_check::has_func_args<F, std::decay_t<T>, Args...>, bool> = true>
     auto operator()(Args&&... args) {
         t_ = f_(t_, args...);
     }
@@ -25,6 +29,9 @@ private:
     T t_;
 };
 
+template <typename F, typename T>
+ReduceHandler(F&& f, T&& t) -> ReduceHandler<std::decay_t<F>, std::decay_t<T>>;
+
 }  // namespace lodash::type_utility
 
 #endif  // LODASH_TYPE_UTILITY_REDUCE_HANDLER_H
@@ -0,0 +1,44 @@
+#ifndef LODASH_TYPE_UTILITY_RESERVE_CONTAINER_H
+#define LODASH_TYPE_UTILITY_RESERVE_CONTAINER_H
+
+#include <cstddef>
+#include <type_traits>
+
+namespace lodash::type_utility {
+
+template <typename, typename = void>
+constexpr bool has_reserve{};
+
+template <typename T>
+constexpr bool has_reserve<T, std::void_t<decltype(std::declval<T&>().reserve(size_t(1)))> > = true;
+
+// ReserveContainer makes room for n more elements in the container if it supports reserve, so that pushing them
+// back reallocates at most once. Containers without reserve are left unchanged.
+template <typename Container>
+constexpr void ReserveContainer(Container& c, [[maybe_unused]] size_t n) {
+    if constexpr (has_reserve<Container>) {
+        if (n > 0) {
+            c.reserve(c.size() + n);
+        }
+    }
+}
+
+template <typename, typename = void>
+constexpr bool has_inline_capacity{};
+
+template <typename T>
+constexpr bool has_inline_capacity<T, std::void_t<decltype(T::inline_capacity())> > = true;
+
+// ReserveUpTo makes room for up to n more elements, a bound on what is pushed back, e.g. by Filter. Containers with
+// inline storage, e.g. container::SmallVector, are left unchanged so that a result shorter than the bound does not
+// allocate.
+template <typename Container>
+constexpr void ReserveUpTo(Container& c, size_t n) {
+    if constexpr (!has_inline_capacity<Container>) {
+        ReserveContainer(c, n);
+    }
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_RESERVE_CONTAINER_H
@@ -0,0 +1,83 @@
+#ifndef LODASH_TYPE_UTILITY_RETAIN_IF_H
+#define LODASH_TYPE_UTILITY_RETAIN_IF_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "../simd/compact.h"
+#include "../stats.h"
+#include "../type_check/is_map.h"
+#include "../type_check/is_random_access.h"
+#include "./compact_into.h"
+#include "./visit_container.h"
+
+namespace lodash::type_utility {
+
+template <typename, typename = void>
+constexpr bool has_erase_after{};
+
+template <typename T>
+constexpr bool has_erase_after<T, std::void_t<decltype(std::declval<T&>().erase_after(std::declval<T&>().begin()))> > =
+        true;
+
+// RetainIf erases, in place and keeping the order of the others, the elements of c for which `bool(f(...)) != keep`.
+// f is invoked exactly once per element in order, with the same arguments as VisitContainer.
+// Contiguous containers of trivially copyable values go through simd::CompactBy, other random-access containers
+// are compacted by moving the kept elements forward, and node-based containers erase the nodes one by one, so no
+// memory is allocated.
+template <typename Container, typename F>
+inline void RetainIf(Container& c, F& f, bool keep) {
+    if constexpr (use_compaction<Container, Container&, F&> && !type_check::is_map<Container>) {
+        stats::AddVisits(c.size());
+        c.resize(simd::CompactBy(c.data(), c.size(), c.data(), f, keep));
+    } else if constexpr (type_check::is_random_access<Container> && !type_check::is_map<Container>) {
+        auto first = std::begin(c);
+        auto out = first;
+        auto n = static_cast<size_t>(std::end(c) - first);
+
+        for (size_t ix = 0; ix < n; ix++) {
+            auto it = first + ix;
+            if (static_cast<bool>(InvokeVisitor<Container>(f, *it, ix)) == keep) {
+                if (out != it) {
+                    *out = std::move(*it);
+                }
+
+                ++out;
+            }
+        }
+
+        c.erase(out, std::end(c));
+        stats::AddVisits(n);
+    } else if constexpr (has_erase_after<Container>) {
+        auto prev = c.before_begin();
+        size_t ix = 0;
+
+        for (auto it = std::begin(c); it != std::end(c); ix++) {
+            if (static_cast<bool>(InvokeVisitor<Container>(f, *it, ix)) == keep) {
+                prev = it++;
+            } else {
+                it = c.erase_after(prev);
+            }
+        }
+
+        stats::AddVisits(ix);
+    } else {
+        size_t ix = 0;
+
+        for (auto it = std::begin(c); it != std::end(c); ix++) {
+            if (static_cast<bool>(InvokeVisitor<Container>(f, *it, ix)) == keep) {
+                ++it;
+            } else {
+                it = c.erase(it);
+            }
+        }
+
+        stats::AddVisits(ix);
+    }
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_RETAIN_IF_H
@@ -0,0 +1,42 @@
+#ifndef LODASH_TYPE_UTILITY_UNIQUE_SET_H
+#define LODASH_TYPE_UTILITY_UNIQUE_SET_H
+
+#include <functional>
+#include <memory_resource>
+#include <set>
+#include <type_traits>
+
+#include "../container/flat_hash_set.h"
+#include "../type_check/is_hashable.h"
+#include "./memory_resource.h"
+
+namespace lodash::type_utility {
+
+// unique_set_t is the scratch set used to deduplicate values of T: a FlatHashSet if T is hashable,
+// otherwise a std::set for types which are only ordered. Both allocate from Resource.
+template <typename T, typename Resource = DefaultResource>
+using unique_set_t = std::conditional_t<
+        type_check::is_hashable<T>,
+        container::FlatHashSet<T,
+                               std::hash<T>,
+                               std::equal_to<T>,
+                               std::conditional_t<is_default_resource_v<Resource>,
+                                                  std::allocator<T>,
+                                                  std::pmr::polymorphic_allocator<T>>>,
+        rebind_container_t<std::set<T>, Resource>>;
+
+// MakeUniqueSet returns an empty unique_set_t<T> with room for expected_size values.
+template <typename T, typename Resource = DefaultResource>
+inline auto MakeUniqueSet(size_t expected_size, Resource resource = Resource()) {
+    auto se = MakeContainer<unique_set_t<T, Resource>>(resource);
+
+    if constexpr (type_check::is_hashable<T>) {
+        se.reserve(expected_size);
+    }
+
+    return se;
+}
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_UNIQUE_SET_H
@@ -1,11 +1,14 @@
 #ifndef LODASH_TYPE_UTILITY_VISIT_CONTAINER_H
 #define LODASH_TYPE_UTILITY_VISIT_CONTAINER_H
 
+#include <iterator>
 #include <type_traits>
 
+#include "../stats.h"
 #include "../type_check/common.h"
-#include "../type_check/has_func_args.h"
-#include "../type_check/is_map.h"
+#include "../type_check/is_random_access.h"
+#include "./is_constant_evaluated.h"
+#include "./visitor_form.h"
 
 namespace lodash::type_utility {
 
@@ -15,126 +18,103 @@ struct NodeInfo {
     bool is_last;
 };
 
+// NoNodeInfo is passed to the handlers which do not declare that they need a NodeInfo.
+struct NoNodeInfo {};
+
 struct ReturnInfo {
     bool need_exit{false};
 };
 
-inline auto default_visit_handler = []([[maybe_unused]] auto... t) -> ReturnInfo {
+// need_node_info_v checks whether a visit handler declares `static constexpr bool kNeedNodeInfo = true`.
+// Only those handlers are passed a NodeInfo, so the traversal does not compute is_last for the others.
+template <typename H, typename = void>
+constexpr bool need_node_info_v{};
+
+template <typename H>
+constexpr bool need_node_info_v<H, std::enable_if_t<std::decay_t<H>::kNeedNodeInfo> > = true;
+
+inline constexpr auto default_visit_handler = []([[maybe_unused]] auto... t) -> ReturnInfo {
     return ReturnInfo{};
 };
 
-template <typename Container,
-          std::enable_if_t<type_check::is_map<std::decay_t<Container>>, bool> = true,
-          typename F,
-          typename H>
-inline void VisitContainer(Container&& c, F&& f, H&& h) {
-    size_t ix = 0;
-
-    using key_type = typename std::decay_t<Container>::key_type;
-    using mapped_type = typename std::decay_t<Container>::mapped_type;
-    using value_type = typename std::decay_t<Container>::value_type;
-
-    auto begin = std::begin(c);
-    auto end_it = std::end(c);
-
-    while (begin != end_it) {
-        auto node_info = NodeInfo{ix, begin == std::begin(c), begin == std::prev(end_it)};
-        if constexpr (type_check::has_func_args_2<F, value_type&, size_t>) {
-            using return_type = std::result_of_t<F(value_type&, size_t)>;
-            if constexpr (std::is_void_v<return_type>) {
-                f(*begin, ix);
-            } else {
-                auto res = h(f(*begin, ix), *begin, node_info);
-                if (res.need_exit) {
-                    break;
-                }
-            }
-        } else if constexpr (type_check::has_func_args_1<F, value_type&>) {
-            using return_type = std::result_of_t<F(value_type&)>;
-            if constexpr (std::is_void_v<return_type>) {
-                f(*begin);
-            } else {
-                auto res = h(f(*begin), *begin, node_info);
-                if (res.need_exit) {
-                    break;
-                }
-            }
-        } else {
-            if constexpr (type_check::has_func_args_3<F, key_type, mapped_type&, size_t>) {
-                using return_type = std::result_of_t<F(key_type, mapped_type&, size_t)>;
-                if constexpr (std::is_void_v<return_type>) {
-                    f(begin->first, begin->second, ix);
-                } else {
-                    auto res = h(f(begin->first, begin->second, ix), *begin, node_info);
-                    if (res.need_exit) {
-                        break;
-                    }
-                }
-            } else if constexpr (type_check::has_func_args_2<F, key_type, mapped_type&>) {
-                using return_type = std::result_of_t<F(key_type, mapped_type&)>;
-                if constexpr (std::is_void_v<return_type>) {
-                    f(begin->first, begin->second);
-                } else {
-                    auto res = h(f(begin->first, begin->second), *begin, node_info);
-                    if (res.need_exit) {
-                        break;
-                    }
-                }
-            } else {
-                static_assert(type_check::false_v<Container>, "invalid function arguments");
-            }
-        }
+// InvokeVisitor invokes f with an element of a container and its index: `f(value, ix)` or `f(value)`, and for maps
+// also `f(key, mapped, ix)` or `f(key, mapped)`, the first form f accepts wins.
+template <typename Container, typename F, typename V>
+constexpr decltype(auto) InvokeVisitor(F&& f, V&& v, [[maybe_unused]] size_t ix) {
+    constexpr auto form = visitor_form_v<Container, F>;
+
+    if constexpr (form == VisitorForm::kValueIndex) {
+        return f(v, ix);
+    } else if constexpr (form == VisitorForm::kValue) {
+        return f(v);
+    } else if constexpr (form == VisitorForm::kKeyMappedIndex) {
+        return f(v.first, v.second, ix);
+    } else if constexpr (form == VisitorForm::kKeyMapped) {
+        return f(v.first, v.second);
+    } else {
+        static_assert(type_check::false_v<Container>, "invalid function arguments");
+    }
+}
 
-        ++ix;
-        ++begin;
+// VisitNode invokes f with one element and passes the result to h, it returns whether the traversal has to stop.
+// is_last is only evaluated for the handlers which need a NodeInfo.
+template <typename Container, typename F, typename H, typename V, typename IsLast>
+constexpr bool VisitNode(F&& f, H&& h, V&& v, size_t ix, [[maybe_unused]] IsLast&& is_last) {
+    using return_type = decltype(InvokeVisitor<Container>(f, v, ix));
+
+    if constexpr (std::is_void_v<return_type>) {
+        InvokeVisitor<Container>(f, v, ix);
+        return false;
+    } else if constexpr (need_node_info_v<H>) {
+        return h(InvokeVisitor<Container>(f, v, ix), v, NodeInfo{ix, ix == 0, is_last()}).need_exit;
+    } else {
+        return h(InvokeVisitor<Container>(f, v, ix), v, NoNodeInfo{}).need_exit;
     }
 }
 
-template <typename Container,
-          std::enable_if_t<!type_check::is_map<std::decay_t<Container>>, bool> = true,
-          typename F,
-          typename H>
-inline void VisitContainer(Container&& c, F&& f, H&& h) {
+// VisitContainer invokes f with each element of the container in order, see InvokeVisitor for the accepted forms of
+// f, and passes each non-void result to `h(result, element, node_info)` which returns a ReturnInfo.
+// Random-access containers are traversed with an index loop, other containers only need forward iterators.
+// It can be evaluated at compile time, e.g. over a std::array, if f and h can.
+template <typename Container, typename F, typename H>
+constexpr void VisitContainer(Container&& c, F&& f, H&& h) {
+    using container_type = std::decay_t<Container>;
+
+    // ix ends as the number of visited elements.
     size_t ix = 0;
 
-    using value_type = typename std::decay_t<Container>::value_type;
-
-    auto begin = std::begin(c);
-    auto end_it = std::end(c);
-
-    while (begin != end_it) {
-        auto node_info = NodeInfo{ix, begin == std::begin(c), begin == std::prev(end_it)};
-        if constexpr (type_check::has_func_args_2<F, value_type&, size_t>) {
-            using return_type = std::result_of_t<F(value_type&, size_t)>;
-            if constexpr (std::is_void_v<return_type>) {
-                f(*begin, ix);
-            } else {
-                auto res = h(f(*begin, ix), *begin, node_info);
-                if (res.need_exit) {
-                    break;
-                }
+    if constexpr (type_check::is_random_access<container_type>) {
+        auto first = std::begin(c);
+        auto n = static_cast<size_t>(std::end(c) - first);
+
+        for (; ix < n; ix++) {
+            if (VisitNode<container_type>(f, h, first[ix], ix, [ix, n] {
+                    return ix + 1 == n;
+                })) {
+                ++ix;
+                break;
             }
-        } else if constexpr (type_check::has_func_args_1<F, value_type&>) {
-            using return_type = std::result_of_t<F(value_type&)>;
-            if constexpr (std::is_void_v<return_type>) {
-                f(*begin);
-            } else {
-                auto res = h(f(*begin), *begin, node_info);
-                if (res.need_exit) {
-                    break;
-                }
+        }
+    } else {
+        auto end_it = std::end(c);
+
+        for (auto it = std::begin(c); it != end_it; ++it, ++ix) {
+            if (VisitNode<container_type>(f, h, *it, ix, [&it, &end_it] {
+                    return std::next(it) == end_it;
+                })) {
+                ++ix;
+                break;
             }
-        } else {
-            static_assert(type_check::false_v<Container>, "invalid function arguments");
         }
+    }
 
-        ++ix;
-        ++begin;
+    if (!IsConstantEvaluated()) {
+        stats::AddVisits(ix);
     }
 }
 
 template <typename Container, typename F>
-inline void VisitContainer(Container&& c, F&& f) {
+constexpr void VisitContainer(Container&& c, F&& f) {
     VisitContainer(std::forward<Container>(c), std::forward<F>(f), default_visit_handler);
 }
 
@@ -0,0 +1,52 @@
+#ifndef LODASH_TYPE_UTILITY_VISITOR_FORM_H
+#define LODASH_TYPE_UTILITY_VISITOR_FORM_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../type_check/has_func_args.h"
+#include "../type_check/is_map.h"
+
+namespace lodash::type_utility {
+
+// VisitorForm is the form a callback is invoked with by VisitContainer.
+enum class VisitorForm {
+    kValueIndex,      // f(value, ix)
+    kValue,           // f(value)
+    kKeyMappedIndex,  // f(key, mapped, ix), maps only
+    kKeyMapped,       // f(key, mapped), maps only
+    kNone,            // f accepts none of them
+};
+
+// GetVisitorForm returns the first form an F accepts for the elements of a Container, the arities are probed once
+// here and both the invocation and the result type of the callbacks are derived from it.
+template <typename Container, typename F>
+constexpr VisitorForm GetVisitorForm() {
+    using value_type = typename Container::value_type;
+
+    if constexpr (type_check::has_func_args<F, value_type&, size_t>) {
+        return VisitorForm::kValueIndex;
+    } else if constexpr (type_check::has_func_args<F, value_type&>) {
+        return VisitorForm::kValue;
+    } else if constexpr (type_check::is_map<Container>) {
+        using key_type = typename Container::key_type;
+        using mapped_type = typename Container::mapped_type;
+
+        if constexpr (type_check::has_func_args<F, key_type, mapped_type&, size_t>) {
+            return VisitorForm::kKeyMappedIndex;
+        } else if constexpr (type_check::has_func_args<F, key_type, mapped_type&>) {
+            return VisitorForm::kKeyMapped;
+        } else {
+            return VisitorForm::kNone;
+        }
+    } else {
+        return VisitorForm::kNone;
+    }
+}
+
+template <typename Container, typename F>
+constexpr VisitorForm visitor_form_v = GetVisitorForm<std::decay_t<Container>, F>();
+
+}  // namespace lodash::type_utility
+
+#endif  // LODASH_TYPE_UTILITY_VISITOR_FORM_H
@@ -0,0 +1,411 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <list>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "lodash/container/small_vector.h"
+#include "lodash/lodash.h"
+
+namespace {
+
+// allocations counts the calls of the global operator new made by the thread.
+thread_local size_t allocations = 0;
+
+}  // namespace
+
+// The replacements count every allocation of the unit tests; the array and nothrow forms forward to them.
+// GCC sees the std::free of the replaced operator delete inlined next to the operator new it knows and warns.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(size_t size) {
+    ++allocations;
+    if (auto* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace lodash::test {
+
+// The budgets are the allocations an algorithm may do on inputs of n distinct ints. They are exact where the
+// algorithm sizes its result up front, and bound by the geometric growth of the result where it cannot know its size.
+class AllocationTest : public testing::Test {
+protected:
+    virtual void SetUp() override {
+        // The first algorithm called on a thread registers its stats counters, which allocates.
+        Count(std::vector<int>(), 0);
+    }
+
+    // CountAllocations returns the number of allocations done by f, including the ones of the result it discards.
+    template <typename F>
+    static size_t CountAllocations(F&& f) {
+        auto before = allocations;
+        f();
+        return allocations - before;
+    }
+
+    // GrowthAllocations returns the number of allocations of a vector growing to n elements by push_back.
+    static size_t GrowthAllocations(size_t n) {
+        size_t res = 1;
+        for (size_t capacity = 1; capacity < n; capacity *= 2) {
+            ++res;
+        }
+
+        return res;
+    }
+
+    // MakeInput returns the n distinct ints of [offset, offset + n) in a shuffled order.
+    static std::vector<int> MakeInput(size_t n, int offset = 0) {
+        auto res = std::vector<int>();
+        for (size_t i = 0; i < n; i++) {
+            res.push_back(static_cast<int>(i * 2654435761u % n) + offset);
+        }
+
+        return res;
+    }
+
+    // kScratchSetAllocations are the allocations of a FlatHashSet reserved up front: its control bytes and its slots.
+    static constexpr size_t kScratchSetAllocations = 2;
+
+    const std::array<size_t, 3> sizes = {10, 1000, 100000};
+};
+
+TEST_F(AllocationTest, sized_result) {
+    for (auto n : sizes) {
+        const auto t = MakeInput(n);
+        const auto l = std::list<int>(t.begin(), t.end());
+
+        auto nested = std::vector<std::vector<std::vector<int>>>();
+        for (size_t i = 0; i < n; i += 10) {
+            nested.push_back({std::vector<int>(5, 1), std::vector<int>(5, 2)});
+        }
+
+        auto is_even = [](int x) {
+            return x % 2 == 0;
+        };
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Map(t, [](int x) {
+                          return x * 2;
+                      });
+                  }),
+                  1)
+                << n;
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Map(l, [](int x) {
+                          return x * 2;
+                      });
+                  }),
+                  1)
+                << n;
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Filter(t, is_even);
+                  }),
+                  1)
+                << n;
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Reject(t, is_even);
+                  }),
+                  1)
+                << n;
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Compact(t);
+                  }),
+                  1)
+                << n;
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Replace(t, 1, 2);
+                  }),
+                  1)
+                << n;
+
+        // Flatten sizes the result from all the levels, there is no intermediate container per level.
+        EXPECT_EQ(CountAllocations([&] {
+                      Flatten(nested);
+                  }),
+                  1)
+                << n;
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Times(n, [](size_t i) {
+                          return i;
+                      });
+                  }),
+                  1)
+                << n;
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Range(static_cast<int>(n));
+                  }),
+                  1)
+                << n;
+    }
+}
+
+TEST_F(AllocationTest, scratch_set) {
+    for (auto n : sizes) {
+        const auto t1 = MakeInput(n);
+        const auto t2 = MakeInput(n, static_cast<int>(n / 2));
+
+        // The scratch set is reserved once, only the result grows.
+        EXPECT_LE(CountAllocations([&] {
+                      Uniq(t1);
+                  }),
+                  kScratchSetAllocations + GrowthAllocations(n))
+                << n;
+
+        EXPECT_LE(CountAllocations([&] {
+                      UniqBy(t1, [](int x) {
+                          return x / 2;
+                      });
+                  }),
+                  kScratchSetAllocations + GrowthAllocations(n))
+                << n;
+
+        EXPECT_LE(CountAllocations([&] {
+                      Intersect(t1, t2);
+                  }),
+                  kScratchSetAllocations + GrowthAllocations(n))
+                << n;
+
+        EXPECT_LE(CountAllocations([&] {
+                      Union(t1, t2);
+                  }),
+                  kScratchSetAllocations + GrowthAllocations(2 * n))
+                << n;
+
+        {
+            auto c = t1;
+            EXPECT_EQ(CountAllocations([&] {
+                          UniqInPlace(c);
+                      }),
+                      kScratchSetAllocations)
+                    << n;
+        }
+    }
+}
+
+TEST_F(AllocationTest, sorted_merge) {
+    for (auto n : sizes) {
+        auto t1 = MakeInput(n);
+        auto t2 = MakeInput(n, static_cast<int>(n / 2));
+        std::sort(t1.begin(), t1.end());
+        std::sort(t2.begin(), t2.end());
+
+        EXPECT_LE(CountAllocations([&] {
+                      IntersectSorted(t1, t2);
+                  }),
+                  GrowthAllocations(n))
+                << n;
+
+        EXPECT_LE(CountAllocations([&] {
+                      UnionSorted(t1, t2);
+                  }),
+                  GrowthAllocations(2 * n))
+                << n;
+    }
+}
+
+TEST_F(AllocationTest, no_allocation) {
+    for (auto n : sizes) {
+        const auto t = MakeInput(n);
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Reduce(
+                              t,
+                              [](int64_t acc, int x) {
+                                  return acc + x;
+                              },
+                              int64_t(0));
+                      Sum(t);
+                      Count(t, 1);
+                      CountBy(t, Gt(1));
+                      Contains(t, -1);
+                      EveryBy(t, Gt(-1));
+                      SomeBy(t, Lt(0));
+                      NoneBy(t, Lt(0));
+                      ForEach(t, [](int) {});
+                  }),
+                  0)
+                << n;
+
+        EXPECT_EQ(CountAllocations([&] {
+                      auto r = RangeView(static_cast<int>(n));
+                      Sum(r);
+                      CountBy(r, Gt(1));
+                      Contains(r, -1);
+                  }),
+                  0)
+                << n;
+
+        {
+            auto c = t;
+            EXPECT_EQ(CountAllocations([&] {
+                          FilterInPlace(c, Gt(static_cast<int>(n / 2)));
+                          RejectInPlace(c, Lt(static_cast<int>(n / 4)));
+                          ReplaceInPlace(c, 1, 2);
+                          CompactInPlace(c);
+                      }),
+                      0)
+                    << n;
+        }
+    }
+}
+
+// An rvalue input is recycled as the result, only the scratch set is allocated.
+TEST_F(AllocationTest, rvalue) {
+    for (auto n : sizes) {
+        const auto t = MakeInput(n);
+
+        auto is_even = [](int x) {
+            return x % 2 == 0;
+        };
+
+        {
+            auto c = t;
+            EXPECT_EQ(CountAllocations([&] {
+                          Filter(std::move(c), is_even);
+                      }),
+                      0)
+                    << n;
+        }
+
+        {
+            auto c = t;
+            EXPECT_EQ(CountAllocations([&] {
+                          Map(std::move(c), [](int x) {
+                              return x * 2;
+                          });
+                      }),
+                      0)
+                    << n;
+        }
+
+        {
+            auto c = t;
+            EXPECT_EQ(CountAllocations([&] {
+                          Uniq(std::move(c));
+                      }),
+                      kScratchSetAllocations)
+                    << n;
+        }
+    }
+}
+
+// A result with inline storage does not allocate while it is short, whatever the size of the input.
+TEST_F(AllocationTest, small_result) {
+    using R = container::SmallVector<int, 16>;
+
+    for (auto n : sizes) {
+        const auto t1 = MakeInput(n);
+        const auto t2 = MakeInput(8, static_cast<int>(n) - 4);
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Filter<R>(t1, Lt(16));
+                      Reject<R>(t1, Gt(7));
+                      Map<R>(t2, [](int x) {
+                          return x * 2;
+                      });
+                  }),
+                  0)
+                << n;
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Uniq<R>(t2);
+                  }),
+                  kScratchSetAllocations)
+                << n;
+
+        EXPECT_EQ(CountAllocations([&] {
+                      Intersect<R>(t1, t2);
+                  }),
+                  kScratchSetAllocations)
+                << n;
+    }
+}
+
+// With a memory resource, the results and the scratch sets do not touch the global heap.
+TEST_F(AllocationTest, memory_resource) {
+    const size_t n = 1000;
+    const auto t1 = MakeInput(n);
+    const auto t2 = MakeInput(n, static_cast<int>(n / 2));
+
+    auto buffer = std::vector<std::byte>(1 << 20);
+
+    EXPECT_EQ(CountAllocations([&] {
+                  std::pmr::monotonic_buffer_resource arena{
+                          buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+                  Uniq(&arena, t1);
+                  Intersect(&arena, t1, t2);
+                  Union(&arena, t1, t2);
+                  Filter(&arena, t1, Gt(0));
+              }),
+              0);
+}
+
+// The elements which own memory allocate on copy, that is the cost of the element and not of the algorithm.
+TEST_F(AllocationTest, element_allocation) {
+    const size_t n = 1000;
+
+    auto t = std::vector<std::string>();
+    for (size_t i = 0; i < n; i++) {
+        t.push_back(std::string(32, 'a') + std::to_string(i));
+    }
+
+    EXPECT_EQ(CountAllocations([&] {
+                  Filter(t, [](const std::string&) {
+                      return true;
+                  });
+              }),
+              1 + n);
+
+    // A type which is only ordered is deduplicated in a std::set, which allocates a node per distinct element.
+    auto t2 = std::vector<std::pair<int, int>>();
+    for (size_t i = 0; i < n; i++) {
+        t2.emplace_back(static_cast<int>(i), 0);
+    }
+
+    EXPECT_EQ(CountAllocations([&] {
+                  Uniq(t2);
+              }),
+              n + GrowthAllocations(n));
+}
+
+}  // namespace lodash::test
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Compares two google-benchmark JSON outputs and fails when a benchmark regressed.
+
+The repetitions of each benchmark are compared by their median CPU time. A benchmark regressed when its median is
+slower than the baseline by more than the threshold and the Mann-Whitney U test says the slowdown is not noise.
+
+Usage: bench_compare.py BASELINE CONTENDER [--threshold PERCENT] [--alpha ALPHA]
+       bench_compare.py --export BASELINE RESULT
+
+The second form writes the repetitions of RESULT to BASELINE, leaving out the fields the comparison does not use.
+"""
+
+import argparse
+import json
+import math
+import statistics
+import sys
+
+TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_runs(path):
+    """Returns {run_name: [cpu_time_ns, ...]} with one entry per repetition."""
+    with open(path) as f:
+        data = json.load(f)
+
+    runs = {}
+    for b in data.get("benchmarks", []):
+        if b.get("run_type", "iteration") != "iteration" or b.get("error_occurred"):
+            continue
+
+        name = b["run_name"] if "run_name" in b else b["name"]
+        runs.setdefault(name, []).append(b["cpu_time"] * TIME_UNIT_NS[b.get("time_unit", "ns")])
+
+    return runs
+
+
+def mann_whitney_u_p_value(xs, ys):
+    """One-sided p-value of the hypothesis that ys tend to be larger than xs.
+
+    Uses the normal approximation with tie and continuity corrections, which needs a few repetitions on each side to
+    mean anything; with fewer than 3 the p-value is None.
+    """
+    n1, n2 = len(xs), len(ys)
+    if n1 < 3 or n2 < 3:
+        return None
+
+    values = sorted([(v, 0) for v in xs] + [(v, 1) for v in ys])
+    ranks = [0.0] * len(values)
+    tie_term = 0.0
+
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+
+        t = j - i + 1
+        tie_term += t**3 - t
+        i = j + 1
+
+    rank_sum_y = sum(r for r, (_, side) in zip(ranks, values) if side == 1)
+    u = rank_sum_y - n2 * (n2 + 1) / 2
+    mean = n1 * n2 / 2
+    n = n1 + n2
+    variance = n1 * n2 / 12 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+
+    z = (u - mean - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2))
+
+
+def export_baseline(path, result_path):
+    runs = load_runs(result_path)
+    with open(path, "w") as f:
+        f.write('{\n  "benchmarks": [\n')
+        f.write(",\n".join('    {"run_name": %s, "cpu_time": %s, "time_unit": "ns"}' % (json.dumps(name), "%.6g" % t)
+                            for name, times in sorted(runs.items()) for t in times))
+        f.write("\n  ]\n}\n")
+
+    print("bench_compare: wrote %d benchmarks to %s" % (len(runs), path))
+    return 0
+
+
+def format_ns(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return "%.2f %s" % (ns / scale, unit)
+
+    return "%.1f ns" % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--export", action="store_true", help="write the baseline instead of comparing")
+    parser.add_argument("baseline")
+    parser.add_argument("contender", help="the google-benchmark JSON output to check")
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown of the median, in percent")
+    parser.add_argument("--alpha", type=float, default=0.01, help="significance level of the U test")
+    args = parser.parse_args()
+
+    if args.export:
+        return export_baseline(args.baseline, args.contender)
+
+    baseline = load_runs(args.baseline)
+    contender = load_runs(args.contender)
+
+    names = sorted(name for name in contender if name in baseline)
+    if not names:
+        print("bench_compare: no benchmark of %s is in %s" % (args.contender, args.baseline))
+        return 1
+
+    width = max(len(name) for name in names)
+    print("%-*s %12s %12s %9s %8s  %s" % (width, "Benchmark", "Baseline", "Contender", "Change", "p-value", "Status"))
+    print("-" * (width + 60))
+
+    regressions = []
+    for name in names:
+        base, new = baseline[name], contender[name]
+        base_median, new_median = statistics.median(base), statistics.median(new)
+        change = (new_median / base_median - 1) * 100 if base_median > 0 else 0.0
+        # p is the p-value of the U test in the direction of the change of the medians.
+        p = mann_whitney_u_p_value(base, new) if change >= 0 else mann_whitney_u_p_value(new, base)
+        significant = p is None or p < args.alpha
+
+        status = "ok"
+        if change > args.threshold:
+            status = "REGRESSED" if significant else "noise"
+        elif change < -args.threshold and significant:
+            status = "improved"
+
+        if status == "REGRESSED":
+            regressions.append(name)
+
+        print("%-*s %12s %12s %+8.1f%% %8s  %s" % (width, name, format_ns(base_median), format_ns(new_median), change,
+                                                  "-" if p is None else "%.4f" % p, status))
+
+    missing = sorted(set(baseline) - set(contender))
+    if missing:
+        print("\n%d baseline benchmarks were not run, e.g. %s" % (len(missing), missing[0]))
+
+    if regressions:
+        print("\n%d of %d benchmarks regressed by more than %.1f%%:" % (len(regressions), len(names), args.threshold))
+        for name in regressions:
+            print("  " + name)
+
+        return 1
+
+    print("\nNo regression above %.1f%% in %d benchmarks." % (args.threshold, len(names)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
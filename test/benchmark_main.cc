@@ -0,0 +1,18 @@
+#include "benchmark/benchmark.h"
+
+#include "./benchmark_util.h"
+
+// The benchmarks are run with a RatioReporter, so a summary of the lodash / stl ratios follows the usual output.
+// `--benchmark_filter` selects a subset, e.g. `--benchmark_filter='^Map/vector<int>/'`.
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    auto reporter = lodash::bench::RatioReporter();
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+
+    return 0;
+}
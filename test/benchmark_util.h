@@ -0,0 +1,286 @@
+#ifndef LODASH_TEST_BENCHMARK_UTIL_H
+#define LODASH_TEST_BENCHMARK_UTIL_H
+
+#include "benchmark/benchmark.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "lodash/type_check/is_contiguous.h"
+#include "lodash/type_check/is_map.h"
+
+namespace lodash::bench {
+
+// LargeStruct is a 128 bytes element, copying it costs as much as copying 32 ints.
+struct LargeStruct {
+    int64_t key{0};
+    std::array<int64_t, 15> payload{};
+
+    bool operator==(const LargeStruct& other) const {
+        return key == other.key;
+    }
+
+    bool operator!=(const LargeStruct& other) const {
+        return key != other.key;
+    }
+
+    bool operator<(const LargeStruct& other) const {
+        return key < other.key;
+    }
+};
+
+}  // namespace lodash::bench
+
+template <>
+struct std::hash<lodash::bench::LargeStruct> {
+    size_t operator()(const lodash::bench::LargeStruct& v) const {
+        return std::hash<int64_t>()(v.key);
+    }
+};
+
+namespace lodash::bench {
+
+// MakeValue returns the element of type T generated from x, distinct x give distinct elements.
+template <typename T>
+inline T MakeValue(uint64_t x) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        // Long enough to live on the heap rather than in the small string buffer.
+        return "lodash-benchmark-" + std::to_string(x);
+    } else if constexpr (std::is_same_v<T, LargeStruct>) {
+        auto v = LargeStruct{};
+        v.key = static_cast<int64_t>(x);
+        v.payload.fill(v.key);
+        return v;
+    } else {
+        return static_cast<T>(x);
+    }
+}
+
+// Project maps an element to an integer, it is the cheap per-element work done by the callbacks of the benchmarks.
+inline int64_t Project(int v) {
+    return v;
+}
+
+inline int64_t Project(double v) {
+    return static_cast<int64_t>(v);
+}
+
+inline int64_t Project(const std::string& v) {
+    return static_cast<int64_t>(v.size()) + v.back();
+}
+
+inline int64_t Project(const LargeStruct& v) {
+    return v.key;
+}
+
+template <typename K, typename V>
+inline int64_t Project(const std::pair<K, V>& v) {
+    return Project(v.second);
+}
+
+template <typename T>
+inline const char* TypeName() {
+    if constexpr (std::is_same_v<T, int>) {
+        return "int";
+    } else if constexpr (std::is_same_v<T, double>) {
+        return "double";
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return "string";
+    } else {
+        return "LargeStruct";
+    }
+}
+
+template <typename Container>
+inline std::string ContainerName() {
+    using value_type = typename Container::value_type;
+
+    if constexpr (type_check::is_map<Container>) {
+        using mapped_type = typename Container::mapped_type;
+        auto prefix = std::is_same_v<Container, std::map<int, mapped_type>> ? "map<int," : "unordered_map<int,";
+        return prefix + std::string(TypeName<mapped_type>()) + ">";
+    } else if constexpr (std::is_same_v<Container, std::vector<value_type>>) {
+        return "vector<" + std::string(TypeName<value_type>()) + ">";
+    } else if constexpr (std::is_same_v<Container, std::deque<value_type>>) {
+        return "deque<" + std::string(TypeName<value_type>()) + ">";
+    } else {
+        return "list<" + std::string(TypeName<value_type>()) + ">";
+    }
+}
+
+// MakeInput returns a container of n elements generated from pseudo-random values in [0, n) shifted by offset, so
+// about a third of them are duplicates. Maps are keyed by the index.
+template <typename Container>
+inline Container MakeInput(size_t n, uint64_t offset = 0) {
+    auto c = Container();
+    for (size_t i = 0; i < n; i++) {
+        auto x = i * 2654435761u % n + offset;
+
+        if constexpr (type_check::is_map<Container>) {
+            c.emplace(static_cast<int>(i), MakeValue<typename Container::mapped_type>(x));
+        } else {
+            c.push_back(MakeValue<typename Container::value_type>(x));
+        }
+    }
+
+    return c;
+}
+
+// kMaxInputBytes bounds the memory of one input, the largest sizes are skipped for the containers whose elements do
+// not fit.
+inline constexpr size_t kMaxInputBytes = size_t(1) << 28;
+
+template <typename Container>
+inline std::vector<int64_t> GetSizes() {
+    using value_type = typename Container::value_type;
+
+    size_t element_bytes = sizeof(value_type);
+    if constexpr (!type_check::is_contiguous<Container>) {
+        // Roughly the links and the allocation header of a node.
+        element_bytes += 32;
+    }
+
+    if constexpr (std::is_same_v<value_type, std::string> ||
+                  std::is_same_v<value_type, std::pair<const int, std::string>>) {
+        // The characters live in their own allocation.
+        element_bytes += 32;
+    }
+
+    auto sizes = std::vector<int64_t>();
+    for (int64_t n = 10; n <= 10'000'000 && n * element_bytes <= kMaxInputBytes; n *= 10) {
+        sizes.push_back(n);
+    }
+
+    return sizes;
+}
+
+// RegisterPair registers `<name>/lodash/<n>` running lodash_op and `<name>/stl/<n>` running stl_op, a hand-written
+// STL equivalent, over the same input `make_input(n)` for each size n. RatioReporter pairs them by name.
+template <typename Container, typename MakeInput, typename LodashOp, typename StlOp>
+inline void RegisterPair(const std::string& name, MakeInput make_input, LodashOp lodash_op, StlOp stl_op) {
+    auto register_one = [&name, &make_input](const char* impl, auto op) {
+        auto full_name = name + "/" + ContainerName<Container>() + "/" + impl;
+        auto* b = benchmark::RegisterBenchmark(full_name.c_str(), [make_input, op](benchmark::State& state) {
+            auto n = static_cast<size_t>(state.range(0));
+            auto input = make_input(n);
+
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(op(input));
+            }
+
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        });
+
+        for (auto n : GetSizes<Container>()) {
+            b->Arg(n);
+        }
+    };
+
+    register_one("lodash", lodash_op);
+    register_one("stl", stl_op);
+}
+
+template <typename Container, typename LodashOp, typename StlOp>
+inline void RegisterPair(const std::string& name, LodashOp lodash_op, StlOp stl_op) {
+    RegisterPair<Container>(
+            name,
+            [](size_t n) {
+                return MakeInput<Container>(n);
+            },
+            std::move(lodash_op),
+            std::move(stl_op));
+}
+
+// ForEachSequenceContainer invokes `f(Container())` for each benchmarked sequence container and element type.
+template <typename F>
+inline void ForEachSequenceContainer(F&& f) {
+    f(std::vector<int>());
+    f(std::vector<double>());
+    f(std::vector<std::string>());
+    f(std::vector<LargeStruct>());
+    f(std::deque<int>());
+    f(std::deque<std::string>());
+    f(std::list<int>());
+    f(std::list<std::string>());
+    f(std::list<LargeStruct>());
+}
+
+// ForEachMapContainer invokes `f(Container())` for each benchmarked map.
+template <typename F>
+inline void ForEachMapContainer(F&& f) {
+    f(std::map<int, int>());
+    f(std::map<int, std::string>());
+    f(std::unordered_map<int, int>());
+    f(std::unordered_map<int, std::string>());
+}
+
+// RatioReporter prints the console output and then, for each `<name>/lodash/<n>` which has a `<name>/stl/<n>`
+// counterpart, the ratio of their CPU times. A ratio of 1.00 means the abstraction is free.
+class RatioReporter : public benchmark::ConsoleReporter {
+public:
+    void ReportRuns(const std::vector<Run>& runs) override {
+        ConsoleReporter::ReportRuns(runs);
+
+        for (auto&& run : runs) {
+            if (run.run_type == Run::RT_Iteration && !run.error_occurred) {
+                auto name = run.benchmark_name();
+                if (cpu_times_.count(name) == 0) {
+                    names_.push_back(name);
+                }
+
+                cpu_times_[name] = run.GetAdjustedCPUTime();
+            }
+        }
+    }
+
+    void Finalize() override {
+        ConsoleReporter::Finalize();
+
+        static const std::string kLodash = "/lodash/";
+        static const std::string kStl = "/stl/";
+        bool has_header = false;
+
+        for (auto&& name : names_) {
+            auto pos = name.find(kLodash);
+            if (pos == std::string::npos) {
+                continue;
+            }
+
+            auto stl_name = name.substr(0, pos) + kStl + name.substr(pos + kLodash.size());
+            auto it = cpu_times_.find(stl_name);
+            if (it == cpu_times_.end() || it->second <= 0) {
+                continue;
+            }
+
+            if (!has_header) {
+                GetOutputStream() << "\n" << std::string(80, '-') << "\n"
+                                  << "lodash / stl CPU time ratio\n"
+                                  << std::string(80, '-') << "\n";
+                has_header = true;
+            }
+
+            char line[256];
+            std::snprintf(line, sizeof(line), "%-70s %8.2f\n", name.c_str(), cpu_times_[name] / it->second);
+            GetOutputStream() << line;
+        }
+    }
+
+private:
+    std::vector<std::string> names_;
+    std::map<std::string, double> cpu_times_;
+};
+
+}  // namespace lodash::bench
+
+#endif  // LODASH_TEST_BENCHMARK_UTIL_H
@@ -0,0 +1,184 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "lodash/lodash.h"
+
+namespace lodash::test {
+
+class ChainTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+};
+
+TEST_F(ChainTest, Value) {
+    const auto t = std::vector<int>({1, 2, 3, 4, 5, 6});
+
+    {
+        auto res = Chain(t).Value();
+        EXPECT_EQ(res, t);
+    }
+
+    {
+        auto res = Chain(t)
+                           .Filter([](int x) {
+                               return x % 2 == 0;
+                           })
+                           .Map([](int x) {
+                               return std::to_string(x * 10);
+                           })
+                           .Value();
+
+        EXPECT_EQ(res, std::vector<std::string>({"20", "40", "60"}));
+    }
+
+    {
+        auto res = Chain(t)
+                           .Reject([](int x) {
+                               return x % 2 == 0;
+                           })
+                           .Map([](int x) {
+                               return x + 1;
+                           })
+                           .Filter([](int x) {
+                               return x > 2;
+                           })
+                           .Value();
+
+        EXPECT_EQ(res, std::vector<int>({4, 6}));
+    }
+
+    {
+        auto res = Chain(std::vector<int>({3, 1, 2}))
+                           .Map([](int x) {
+                               return x * x;
+                           })
+                           .Value<std::deque<int>>();
+
+        EXPECT_EQ(res, std::deque<int>({9, 1, 4}));
+    }
+}
+
+TEST_F(ChainTest, Terminal) {
+    const auto t = std::vector<int>({1, 2, 3, 4, 5, 6});
+
+    {
+        auto res = Chain(t)
+                           .Filter([](int x) {
+                               return x % 2 == 0;
+                           })
+                           .Map([](int x) {
+                               return x * 2;
+                           })
+                           .Sum();
+
+        EXPECT_EQ(res, 24);
+    }
+
+    {
+        auto res = Chain(t)
+                           .Filter([](int x) {
+                               return x > 3;
+                           })
+                           .Reduce(
+                                   [](const std::string& pre, int x) {
+                                       return pre + std::to_string(x);
+                                   },
+                                   std::string(""));
+
+        EXPECT_EQ(res, "456");
+    }
+
+    {
+        auto res = Chain(t)
+                           .Reject([](int x) {
+                               return x > 3;
+                           })
+                           .Count();
+
+        EXPECT_EQ(res, 3);
+    }
+
+    {
+        int res = 0;
+        Chain(t)
+                .Map([](int x) {
+                    return x * 3;
+                })
+                .ForEach([&res](int x) {
+                    res += x;
+                });
+
+        EXPECT_EQ(res, 63);
+    }
+}
+
+TEST_F(ChainTest, Map) {
+    auto t = std::map<int, int>({{1, 2}, {2, 3}, {3, 4}});
+
+    {
+        auto res = Chain(t)
+                           .Filter([](const int& k, [[maybe_unused]] const int& v) {
+                               return k >= 2;
+                           })
+                           .Map([](const int& k, const int& v) {
+                               return k * v;
+                           })
+                           .Value();
+
+        EXPECT_EQ(res, std::vector<int>({6, 12}));
+    }
+
+    {
+        auto res = Chain(t)
+                           .Map([](const auto& kv) {
+                               return kv.second;
+                           })
+                           .Sum();
+
+        EXPECT_EQ(res, 9);
+    }
+}
+
+TEST_F(ChainTest, SinglePass) {
+    auto t = std::vector<int>({1, 2, 3, 4, 5});
+
+    int filter_calls = 0;
+    int map_calls = 0;
+
+    auto res = Chain(t)
+                       .Filter([&filter_calls](int x) {
+                           ++filter_calls;
+                           return x != 3;
+                       })
+                       .Map([&map_calls](int x) {
+                           ++map_calls;
+                           return x;
+                       })
+                       .Count();
+
+    EXPECT_EQ(res, 4);
+    EXPECT_EQ(filter_calls, 5);
+    EXPECT_EQ(map_calls, 4);
+}
+
+// The elements of a range computing them, e.g. RangeView, are passed down the chain by value.
+TEST_F(ChainTest, RangeView) {
+    auto res = Chain(RangeView(1, 7))
+                       .Filter([](int x) {
+                           return x % 2 == 0;
+                       })
+                       .Map([](int x) {
+                           return x * 10;
+                       })
+                       .Value();
+
+    EXPECT_EQ(res, std::vector<int>({20, 40, 60}));
+    EXPECT_EQ(Chain(RangeView(5)).Sum(), 10);
+}
+
+}  // namespace lodash::test
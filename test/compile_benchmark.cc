@@ -0,0 +1,85 @@
+// compile_benchmark.cc measures what instantiating one algorithm costs the compiler, it is compiled by
+// compile_benchmark.py and never linked. LODASH_COMPILE_BENCHMARK_ALGORITHM names the algorithm, called as
+// `Algorithm(c, f)`, and LODASH_COMPILE_BENCHMARK_COUNT the number of distinct callback types it is instantiated with.
+// Without an algorithm, the callbacks are only invoked, which is the baseline the algorithms are compared with.
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "lodash/lodash.h"
+
+#ifndef LODASH_COMPILE_BENCHMARK_COUNT
+#define LODASH_COMPILE_BENCHMARK_COUNT 50
+#endif
+
+namespace lodash::bench {
+
+namespace {
+
+struct Baseline {
+    template <typename Container, typename F>
+    size_t operator()(Container& c, F& f) const {
+        size_t res = 0;
+        for (auto& v : c) {
+            res += static_cast<size_t>(f(v));
+        }
+
+        return res;
+    }
+};
+
+#ifdef LODASH_COMPILE_BENCHMARK_ALGORITHM
+
+struct Algorithm {
+    template <typename Container, typename F>
+    size_t operator()(Container& c, F& f) const {
+        using ::lodash::LODASH_COMPILE_BENCHMARK_ALGORITHM;
+
+        if constexpr (std::is_void_v<decltype(LODASH_COMPILE_BENCHMARK_ALGORITHM(c, f))>) {
+            LODASH_COMPILE_BENCHMARK_ALGORITHM(c, f);
+            return 0;
+        } else {
+            return Size(LODASH_COMPILE_BENCHMARK_ALGORITHM(c, f));
+        }
+    }
+
+    template <typename T>
+    static size_t Size(const T& res) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            return static_cast<size_t>(res);
+        } else {
+            return res.size();
+        }
+    }
+};
+
+#else
+
+using Algorithm = Baseline;
+
+#endif
+
+// Instantiate calls the algorithm with a callback of its own closure type, I makes each of them a new instantiation.
+template <size_t I>
+size_t Instantiate(std::vector<int>& c) {
+    auto f = [](int v) {
+        return v % int(I + 2) == 0;
+    };
+
+    return Algorithm()(c, f);
+}
+
+template <size_t... I>
+size_t InstantiateAll(std::vector<int>& c, std::index_sequence<I...>) {
+    return (Instantiate<I>(c) + ...);
+}
+
+}  // namespace
+
+size_t RunCompileBenchmark(std::vector<int>& c) {
+    return InstantiateAll(c, std::make_index_sequence<LODASH_COMPILE_BENCHMARK_COUNT>());
+}
+
+}  // namespace lodash::bench
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""Measures what instantiating each algorithm costs the compiler.
+
+compile_benchmark.cc is compiled once per algorithm with LODASH_COMPILE_BENCHMARK_ALGORITHM set, and once without as
+the baseline, which only includes lodash.h and instantiates the callbacks. Each algorithm is reported as its cost
+over the baseline, which is what a TU pays for calling it with that many distinct callback types.
+
+With clang, the cost is read from the -ftime-trace output: the total time spent instantiating functions and classes.
+With gcc, which has no -ftime-trace, it is read from the "template instantiation" phase of -ftime-report. The wall
+time of the compiler is reported for both, the fastest of the repetitions is kept.
+
+Usage: compile_benchmark.py --compiler CXX [--flag FLAG ...] [--algorithm NAME ...] [--count N] [--repetitions N]
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+ALGORITHMS = [
+    "Map",
+    "Filter",
+    "Reject",
+    "UniqBy",
+    "CountBy",
+    "SumBy",
+    "ContainsBy",
+    "EveryBy",
+    "SomeBy",
+    "NoneBy",
+    "ForEach",
+]
+
+SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "compile_benchmark.cc")
+
+
+def is_clang(compiler):
+    out = subprocess.run([compiler, "--version"], capture_output=True, text=True).stdout
+    return "clang" in out
+
+
+def time_trace_ms(path):
+    """Returns {phase: ms} of the totals clang writes to a -ftime-trace file."""
+    with open(path) as f:
+        events = json.load(f)["traceEvents"]
+
+    totals = {e["name"][len("Total "):]: e["dur"] / 1e3 for e in events if e.get("name", "").startswith("Total ")}
+    return {
+        "instantiation": totals.get("InstantiateFunction", 0.0) + totals.get("InstantiateClass", 0.0),
+        "frontend": totals.get("Frontend", 0.0),
+    }
+
+
+def time_report_ms(stderr):
+    """Returns {phase: ms} of the -ftime-report gcc writes to stderr."""
+    phases = {"instantiation": 0.0, "frontend": 0.0}
+    for line in stderr.splitlines():
+        m = re.match(r"\s*(.+?)\s*:\s*(?:[\d.]+\s*\(\s*\d+%\)\s*){2}([\d.]+)\s*\(\s*\d+%\)", line)
+        if not m:
+            continue
+
+        name, wall = m.group(1), float(m.group(2)) * 1e3
+        if name == "template instantiation":
+            phases["instantiation"] += wall
+        elif name.startswith("phase parsing") or name.startswith("phase lang. deferred"):
+            phases["frontend"] += wall
+
+    return phases
+
+
+def compile_once(args, clang, algorithm, workdir):
+    obj = os.path.join(workdir, "compile_benchmark.o")
+    cmd = [args.compiler, "-c", SOURCE, "-o", obj, "-DLODASH_COMPILE_BENCHMARK_COUNT=%d" % args.count]
+    cmd += args.flag
+    cmd += ["-ftime-trace"] if clang else ["-ftime-report"]
+    if algorithm:
+        cmd.append("-DLODASH_COMPILE_BENCHMARK_ALGORITHM=" + algorithm)
+
+    start = time.perf_counter()
+    res = subprocess.run(cmd, capture_output=True, text=True)
+    wall = (time.perf_counter() - start) * 1e3
+    if res.returncode != 0:
+        sys.stderr.write(res.stderr)
+        raise RuntimeError("compile_benchmark: %s failed to compile" % (algorithm or "the baseline"))
+
+    phases = time_trace_ms(os.path.splitext(obj)[0] + ".json") if clang else time_report_ms(res.stderr)
+    phases["wall"] = wall
+    return phases
+
+
+def measure(args, clang, algorithm, workdir):
+    """Returns the fastest of the repetitions of each phase."""
+    runs = [compile_once(args, clang, algorithm, workdir) for _ in range(args.repetitions)]
+    return {phase: min(r[phase] for r in runs) for phase in runs[0]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--flag", action="append", default=[], help="a compiler flag, e.g. --flag=-std=c++17")
+    parser.add_argument("--algorithm", action="append", help="an algorithm to measure, all of them by default")
+    parser.add_argument("--count", type=int, default=50, help="distinct callback types each algorithm is called with")
+    parser.add_argument("--repetitions", type=int, default=3, help="compilations of each algorithm")
+    args = parser.parse_args()
+
+    clang = is_clang(args.compiler)
+    with tempfile.TemporaryDirectory() as workdir:
+        try:
+            baseline = measure(args, clang, None, workdir)
+            results = [(name, measure(args, clang, name, workdir)) for name in args.algorithm or ALGORITHMS]
+        except RuntimeError as e:
+            print(e)
+            return 1
+
+    source = "-ftime-trace" if clang else "-ftime-report"
+    print("Instantiation cost of %d callback types, from %s, fastest of %d runs" % (args.count, source,
+                                                                                  args.repetitions))
+    width = max(len(name) for name, _ in results + [("Algorithm", None)])
+    print("%-*s %12s %14s %12s %12s" % (width, "Algorithm", "Wall", "Wall/callback", "Instantiate", "Frontend"))
+    print("-" * (width + 54))
+    print("%-*s %9.0f ms %14s %9.0f ms %9.0f ms" % (width, "(baseline)", baseline["wall"], "-",
+                                                    baseline["instantiation"], baseline["frontend"]))
+
+    for name, phases in results:
+        extra = {phase: phases[phase] - baseline[phase] for phase in phases}
+        print("%-*s %+9.0f ms %+11.2f ms %+9.0f ms %+9.0f ms" % (width, name, extra["wall"],
+                                                                  extra["wall"] / args.count,
+                                                                  extra["instantiation"], extra["frontend"]))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "lodash/container/flat_hash_set.h"
+#include "lodash/lodash.h"
+
+namespace lodash::container::test {
+
+class FlatHashSetTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+};
+
+TEST_F(FlatHashSetTest, InsertAndFind) {
+    auto se = FlatHashSet<int>();
+    EXPECT_TRUE(se.empty());
+    EXPECT_EQ(se.capacity(), 0);
+    EXPECT_FALSE(se.contains(1));
+
+    EXPECT_TRUE(se.insert(1).second);
+    EXPECT_FALSE(se.insert(1).second);
+    EXPECT_TRUE(se.insert(2).second);
+
+    EXPECT_EQ(se.size(), 2);
+    EXPECT_TRUE(se.contains(1));
+    EXPECT_EQ(se.count(2), 1);
+    EXPECT_EQ(se.count(3), 0);
+    EXPECT_EQ(*se.find(2), 2);
+    EXPECT_TRUE(se.find(3) == se.end());
+}
+
+TEST_F(FlatHashSetTest, Grow) {
+    auto se = FlatHashSet<int64_t>();
+    auto expected = std::set<int64_t>();
+
+    for (int64_t i = 0; i < 10000; i++) {
+        auto v = i * 7919 % 4999;
+        EXPECT_EQ(se.insert(v).second, expected.insert(v).second);
+    }
+
+    EXPECT_EQ(se.size(), expected.size());
+    EXPECT_EQ(std::set<int64_t>(se.begin(), se.end()), expected);
+
+    auto capacity = se.capacity();
+    EXPECT_EQ(capacity & (capacity - 1), 0);
+    EXPECT_LE(se.size(), capacity - capacity / 8);
+}
+
+TEST_F(FlatHashSetTest, Reserve) {
+    auto se = FlatHashSet<int>(1000);
+    auto capacity = se.capacity();
+    EXPECT_GE(capacity - capacity / 8, 1000);
+
+    for (int i = 0; i < 1000; i++) {
+        se.insert(i);
+    }
+
+    EXPECT_EQ(se.capacity(), capacity);
+}
+
+TEST_F(FlatHashSetTest, Erase) {
+    auto se = FlatHashSet<std::string>();
+
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 100; i++) {
+            se.insert(std::to_string(i));
+        }
+
+        EXPECT_EQ(se.size(), 100);
+
+        for (int i = 0; i < 100; i += 2) {
+            EXPECT_EQ(se.erase(std::to_string(i)), 1);
+            EXPECT_EQ(se.erase(std::to_string(i)), 0);
+        }
+
+        EXPECT_EQ(se.size(), 50);
+        EXPECT_FALSE(se.contains("0"));
+        EXPECT_TRUE(se.contains("1"));
+
+        for (int i = 1; i < 100; i += 2) {
+            se.erase(std::to_string(i));
+        }
+
+        EXPECT_TRUE(se.empty());
+    }
+
+    EXPECT_LE(se.capacity(), 256);
+}
+
+TEST_F(FlatHashSetTest, CopyAndMove) {
+    auto se = FlatHashSet<std::string>();
+    se.insert("a");
+    se.insert("b");
+
+    auto copied = se;
+    EXPECT_EQ(copied.size(), 2);
+    EXPECT_TRUE(copied.contains("a"));
+
+    auto moved = std::move(copied);
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_TRUE(moved.contains("b"));
+
+    moved = FlatHashSet<std::string>();
+    EXPECT_TRUE(moved.empty());
+
+    moved = se;
+    EXPECT_EQ(moved.size(), 2);
+
+    se.clear();
+    EXPECT_TRUE(se.empty());
+    EXPECT_FALSE(se.contains("a"));
+    EXPECT_TRUE(moved.contains("a"));
+}
+
+}  // namespace lodash::container::test
@@ -0,0 +1,84 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "lodash/container/flatten_range.h"
+#include "lodash/lodash.h"
+
+namespace lodash::container::test {
+
+class FlattenRangeTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+
+    template <typename View>
+    static auto ToVector(const View& view) {
+        return std::vector<std::decay_t<decltype(*view.begin())>>(view.begin(), view.end());
+    }
+};
+
+TEST_F(FlattenRangeTest, FullDepth) {
+    {
+        const auto t = std::vector<std::vector<int>>({{1, 2}, {}, {3}, {}, {}, {4, 5, 6}, {}});
+        EXPECT_EQ(ToVector(FlattenView(t)), std::vector<int>({1, 2, 3, 4, 5, 6}));
+        EXPECT_EQ(std::distance(FlattenView(t).begin(), FlattenView(t).end()), 6);
+    }
+
+    {
+        const auto t = std::list<std::vector<std::list<int>>>({{{1}, {}, {2, 3}}, {}, {{}, {4}}});
+        EXPECT_EQ(ToVector(FlattenView(t)), std::vector<int>({1, 2, 3, 4}));
+    }
+
+    {
+        const auto t = std::vector<std::map<int, std::string>>({{{1, "a"}}, {{2, "b"}, {3, "c"}}});
+        auto view = FlattenView(t);
+        auto it = view.begin();
+        EXPECT_EQ(it->second, "a");
+        EXPECT_EQ((++it)->first, 2);
+        EXPECT_EQ((*it++).second, "b");
+        EXPECT_EQ(it->second, "c");
+        EXPECT_EQ(++it, view.end());
+    }
+}
+
+TEST_F(FlattenRangeTest, empty) {
+    {
+        const auto t = std::vector<std::vector<int>>();
+        EXPECT_TRUE(FlattenView(t).empty());
+    }
+
+    {
+        const auto t = std::vector<std::vector<std::vector<int>>>({{}, {{}, {}}, {}});
+        EXPECT_TRUE(FlattenView(t).empty());
+        EXPECT_EQ(ToVector(FlattenView(t)), std::vector<int>());
+    }
+}
+
+TEST_F(FlattenRangeTest, Depth) {
+    const auto t = std::vector<std::vector<std::vector<int>>>({{{1, 2}, {3}}, {}, {{4}}});
+
+    EXPECT_EQ(ToVector(FlattenView<0>(t)), t);
+    EXPECT_EQ(ToVector(FlattenView<1>(t)), std::vector<std::vector<int>>({{1, 2}, {3}, {4}}));
+    EXPECT_EQ(ToVector(FlattenView<2>(t)), std::vector<int>({1, 2, 3, 4}));
+    EXPECT_EQ(ToVector(FlattenView<3>(t)), std::vector<int>({1, 2, 3, 4}));
+}
+
+TEST_F(FlattenRangeTest, modify) {
+    auto t = std::vector<std::vector<int>>({{1, 2}, {}, {3}});
+
+    for (auto& v : FlattenView(t)) {
+        v *= 10;
+    }
+
+    EXPECT_EQ(t, std::vector<std::vector<int>>({{10, 20}, {}, {30}}));
+
+    auto view = FlattenView(t);
+    EXPECT_EQ(*std::max_element(view.begin(), view.end()), 30);
+}
+
+}  // namespace lodash::container::test
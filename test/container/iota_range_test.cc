@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "lodash/container/iota_range.h"
+#include "lodash/lodash.h"
+
+namespace lodash::container::test {
+
+class IotaRangeTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+};
+
+TEST_F(IotaRangeTest, Iterator) {
+    auto r = IotaRange<int>(0, 100, 3);
+    EXPECT_EQ(r.size(), 34);
+    EXPECT_TRUE((std::is_same_v<std::iterator_traits<decltype(r.begin())>::iterator_category,
+                                std::random_access_iterator_tag>));
+
+    auto it = r.begin();
+    EXPECT_EQ(*it, 0);
+    EXPECT_EQ(*(it + 10), 30);
+    EXPECT_EQ(it[33], 99);
+    EXPECT_EQ(r.end() - it, 34);
+    EXPECT_EQ(*(r.end() - 1), 99);
+    EXPECT_TRUE(it < r.end());
+
+    it += 5;
+    --it;
+    EXPECT_EQ(*it, 12);
+    EXPECT_EQ(std::distance(r.begin(), r.end()), 34);
+    EXPECT_TRUE(std::binary_search(r.begin(), r.end(), 42));
+    EXPECT_FALSE(std::binary_search(r.begin(), r.end(), 43));
+
+    EXPECT_TRUE(IotaRange<int>().empty());
+    EXPECT_TRUE(IotaRange<int>(0, 10, 0).empty());
+}
+
+TEST_F(IotaRangeTest, Algorithm) {
+    const int64_t n = 100000;
+    auto r = RangeView(n);
+    auto t = Range(n);
+
+    EXPECT_EQ(Sum(r), n * (n - 1) / 2);
+
+    auto mod7 = [](int64_t x) {
+        return x % 7;
+    };
+
+    EXPECT_EQ(SumBy(par.WithGrainSize(1000), r, mod7), SumBy(t, mod7));
+    EXPECT_EQ(CountBy(r, Lt(int64_t(10))), 10);
+    EXPECT_TRUE(Contains(r, int64_t(500)));
+    EXPECT_TRUE(EveryBy(r, Gt(int64_t(-1))));
+
+    {
+        auto res = Filter(r, Lt(int64_t(200)));
+        EXPECT_TRUE((std::is_same_v<decltype(res), std::vector<int64_t>>));
+        EXPECT_EQ(res, Range(int64_t(200)));
+    }
+
+    {
+        auto res = Uniq(r);
+        EXPECT_TRUE((std::is_same_v<decltype(res), std::vector<int64_t>>));
+        EXPECT_EQ(res, t);
+    }
+
+    {
+        auto res = Map(r, [](int64_t x) {
+            return x * 2;
+        });
+        EXPECT_EQ(res, Range(int64_t(0), 2 * n, int64_t(2)));
+    }
+
+    {
+        auto res = Map(par.WithGrainSize(1000), r, [](int64_t x) {
+            return x + 1;
+        });
+        EXPECT_EQ(res, Range(int64_t(1), n + 1));
+    }
+
+    {
+        auto res = Intersect(RangeView(int64_t(0), n, int64_t(2)), RangeView(int64_t(0), n, int64_t(3)));
+        EXPECT_EQ(res, Range(int64_t(0), n, int64_t(6)));
+        EXPECT_EQ(IntersectSorted(RangeView(int64_t(0), n, int64_t(2)), RangeView(int64_t(0), n, int64_t(3))), res);
+    }
+
+    {
+        auto res = UnionSorted(RangeView(0, 10, 2), RangeView(0, 10, 3));
+        EXPECT_EQ(res, std::vector<int>({0, 2, 3, 4, 6, 8, 9}));
+    }
+}
+
+}  // namespace lodash::container::test
@@ -0,0 +1,125 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "lodash/container/mapped_array.h"
+#include "lodash/lodash.h"
+
+namespace lodash::container::test {
+
+struct Record {
+    int32_t id;
+    int32_t score;
+};
+
+class MappedArrayTest : public testing::Test {
+protected:
+    virtual void SetUp() override {
+        path = testing::TempDir() + "lodash_mapped_array_test_" +
+               testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+
+    virtual void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    template <typename T>
+    void WriteFile(const std::vector<T>& v) {
+        auto os = std::ofstream(path, std::ios::binary | std::ios::trunc);
+        os.write(reinterpret_cast<const char*>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(T)));
+    }
+
+    std::string path;
+};
+
+TEST_F(MappedArrayTest, Algorithm) {
+    auto t = std::vector<int64_t>();
+    for (int64_t i = 0; i < 100000; i++) {
+        t.push_back(i % 1000);
+    }
+
+    WriteFile(t);
+
+    auto a = MappedArray<int64_t>(path);
+    EXPECT_EQ(a.size(), t.size());
+    EXPECT_TRUE(std::equal(a.begin(), a.end(), t.begin(), t.end()));
+    EXPECT_EQ(a[999], 999);
+    EXPECT_EQ(a.back(), 999);
+
+    EXPECT_EQ(Sum(a), Sum(t));
+    EXPECT_EQ(CountBy(a, Lt(int64_t(10))), 1000);
+    EXPECT_TRUE(Contains(a, int64_t(500)));
+
+    {
+        auto res = Filter(a, Lt(int64_t(2)));
+        EXPECT_TRUE((std::is_same_v<decltype(res), std::vector<int64_t>>));
+        EXPECT_EQ(res.size(), 200);
+    }
+
+    {
+        auto res = Uniq(a);
+        EXPECT_TRUE((std::is_same_v<decltype(res), std::vector<int64_t>>));
+        EXPECT_EQ(res.size(), 1000);
+    }
+
+    {
+        auto res = Map(a, [](int64_t x) {
+            return x * 2;
+        });
+        EXPECT_EQ(res[999], 1998);
+    }
+}
+
+TEST_F(MappedArrayTest, Record) {
+    WriteFile(std::vector<Record>({{1, 90}, {2, 40}, {3, 75}}));
+
+    auto a = MappedArray<Record>(path, MappedArray<Record>::Access::kRandom);
+    EXPECT_EQ(a.size(), 3);
+
+    auto res = Filter(a, [](const Record& r) {
+        return r.score >= 75;
+    });
+
+    EXPECT_EQ(res.size(), 2);
+    EXPECT_EQ(res[1].id, 3);
+}
+
+TEST_F(MappedArrayTest, empty) {
+    WriteFile(std::vector<int>());
+
+    auto a = MappedArray<int>(path);
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.begin(), a.end());
+    EXPECT_EQ(Sum(a), 0);
+}
+
+TEST_F(MappedArrayTest, move) {
+    WriteFile(std::vector<int>({1, 2, 3}));
+
+    auto a = MappedArray<int>(path);
+    auto b = std::move(a);
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(b.size(), 3);
+
+    a = std::move(b);
+    EXPECT_EQ(a[2], 3);
+    EXPECT_TRUE(b.empty());
+}
+
+TEST_F(MappedArrayTest, error) {
+    EXPECT_THROW(MappedArray<int>{path + "_missing"}, std::system_error);
+
+    WriteFile(std::vector<char>({'a', 'b', 'c'}));
+    EXPECT_THROW(MappedArray<int>{path}, std::invalid_argument);
+}
+
+}  // namespace lodash::container::test
@@ -0,0 +1,223 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "lodash/container/small_vector.h"
+#include "lodash/lodash.h"
+
+namespace lodash::container::test {
+
+// Counted counts its live instances, its copy constructor throws once copies_left is exhausted.
+struct Counted {
+    static inline int live = 0;
+    static inline int copies_left = 0;
+
+    Counted() {
+        ++live;
+    }
+
+    Counted(const Counted&) {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("copy");
+        }
+
+        ++live;
+    }
+
+    ~Counted() {
+        --live;
+    }
+
+    Counted& operator=(const Counted&) = default;
+};
+
+class SmallVectorTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+
+    template <typename T, size_t N>
+    static std::vector<T> ToVector(const SmallVector<T, N>& v) {
+        return std::vector<T>(v.begin(), v.end());
+    }
+};
+
+TEST_F(SmallVectorTest, basic) {
+    auto v = SmallVector<std::string, 2>();
+    EXPECT_TRUE(v.empty());
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 2);
+
+    v.push_back("a");
+    v.emplace_back(3, 'b');
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(ToVector(v), std::vector<std::string>({"a", "bbb"}));
+
+    // The element pushed back may be one of the elements which are moved to the heap.
+    v.push_back(v[0]);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 4);
+    EXPECT_EQ(ToVector(v), std::vector<std::string>({"a", "bbb", "a"}));
+
+    v.pop_back();
+    EXPECT_EQ(v.back(), "bbb");
+
+    v.resize(4);
+    EXPECT_EQ(ToVector(v), std::vector<std::string>({"a", "bbb", "", ""}));
+
+    v.resize(1, "c");
+    EXPECT_EQ(ToVector(v), std::vector<std::string>({"a"}));
+
+    v.resize(3, "c");
+    EXPECT_EQ(ToVector(v), std::vector<std::string>({"a", "c", "c"}));
+
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(v.capacity(), 4);
+}
+
+// The value copied by resize may be one of the elements, which growing the storage moves away.
+TEST_F(SmallVectorTest, resize_aliasing) {
+    auto v = SmallVector<std::string, 2>({std::string(40, 'a'), "b"});
+
+    v.resize(5, v[0]);
+    EXPECT_EQ(ToVector(v), std::vector<std::string>({std::string(40, 'a'), "b", std::string(40, 'a'),
+                                                     std::string(40, 'a'), std::string(40, 'a')}));
+
+    // Now on the heap, which is freed by the next growth.
+    v.resize(11, v[4]);
+    EXPECT_EQ(v.size(), 11);
+    EXPECT_EQ(v[10], std::string(40, 'a'));
+}
+
+// An exception thrown by a copy leaves the elements already copied to be destroyed by the SmallVector.
+TEST_F(SmallVectorTest, copy_exception) {
+    {
+        auto a = SmallVector<Counted, 2>(4);
+        auto b = SmallVector<Counted, 2>();
+        EXPECT_EQ(Counted::live, 4);
+
+        Counted::copies_left = 2;
+        EXPECT_THROW(b = a, std::runtime_error);
+        EXPECT_EQ(Counted::live, 4 + static_cast<int>(b.size()));
+    }
+
+    EXPECT_EQ(Counted::live, 0);
+}
+
+TEST_F(SmallVectorTest, erase) {
+    auto v = SmallVector<int, 4>({1, 2, 3, 4, 5});
+
+    EXPECT_EQ(*v.erase(v.begin() + 1), 3);
+    EXPECT_EQ(ToVector(v), std::vector<int>({1, 3, 4, 5}));
+
+    auto it = v.erase(v.begin() + 2, v.end());
+    EXPECT_EQ(it, v.end());
+    EXPECT_EQ(ToVector(v), std::vector<int>({1, 3}));
+
+    EXPECT_EQ(v.erase(v.begin(), v.begin()), v.begin());
+    EXPECT_EQ(v.size(), 2);
+}
+
+TEST_F(SmallVectorTest, copy_and_move) {
+    auto a = SmallVector<std::string, 2>({"a", "b"});
+    auto b = SmallVector<std::string, 2>({"a", "b", "c"});
+
+    {
+        auto c = a;
+        EXPECT_EQ(c, a);
+        c = b;
+        EXPECT_EQ(c, b);
+        c = a;
+        EXPECT_EQ(c, a);
+        EXPECT_NE(c, b);
+    }
+
+    {
+        // The inline elements are moved one by one, the heap storage is taken over.
+        auto c = a;
+        auto d = std::move(c);
+        EXPECT_TRUE(d.is_inline());
+        EXPECT_EQ(d, a);
+        EXPECT_TRUE(c.empty());
+
+        auto e = b;
+        const auto* data = e.data();
+        d = std::move(e);
+        EXPECT_EQ(d.data(), data);
+        EXPECT_EQ(d, b);
+        EXPECT_TRUE(e.empty());
+        EXPECT_TRUE(e.is_inline());
+    }
+}
+
+TEST_F(SmallVectorTest, move_only) {
+    auto v = SmallVector<std::unique_ptr<int>, 1>();
+    v.push_back(std::make_unique<int>(1));
+    v.push_back(std::make_unique<int>(2));
+
+    auto w = std::move(v);
+    EXPECT_EQ(*w[0], 1);
+    EXPECT_EQ(*w[1], 2);
+}
+
+TEST_F(SmallVectorTest, result_container) {
+    auto t = std::vector<int>({3, 1, 3, 2, 0, 1});
+    using R = SmallVector<int, 4>;
+
+    {
+        auto res = Filter<R>(t, Gt(1));
+        EXPECT_TRUE((std::is_same_v<decltype(res), R>));
+        EXPECT_TRUE(res.is_inline());
+        EXPECT_EQ(ToVector(res), std::vector<int>({3, 3, 2}));
+    }
+
+    {
+        auto res = Reject<R>(t, Gt(1));
+        EXPECT_EQ(ToVector(res), std::vector<int>({1, 0, 1}));
+    }
+
+    {
+        auto res = Uniq<R>(t);
+        EXPECT_TRUE(res.is_inline());
+        EXPECT_EQ(ToVector(res), std::vector<int>({3, 1, 2, 0}));
+    }
+
+    {
+        auto other = std::vector<int>({2, 4, 3});
+        auto res = Intersect<R>(t, other);
+        EXPECT_EQ(ToVector(res), std::vector<int>({2, 3}));
+    }
+
+    {
+        auto res = Map<SmallVector<std::string, 8>>(t, [](int x) {
+            return std::to_string(x);
+        });
+        EXPECT_TRUE(res.is_inline());
+        EXPECT_EQ(ToVector(res), std::vector<std::string>({"3", "1", "3", "2", "0", "1"}));
+    }
+
+    {
+        // A result longer than the inline capacity moves to the heap.
+        auto res = Filter<R>(t, Gt(0));
+        EXPECT_FALSE(res.is_inline());
+        EXPECT_EQ(ToVector(res), std::vector<int>({3, 1, 3, 2, 1}));
+    }
+
+    {
+        // A SmallVector is an input like any other, an rvalue one is filtered in place.
+        auto c = SmallVector<int, 2>(t.begin(), t.end());
+        const auto* data = c.data();
+        auto res = Filter(std::move(c), Gt(1));
+        EXPECT_EQ(res.data(), data);
+        EXPECT_EQ(ToVector(res), std::vector<int>({3, 3, 2}));
+        EXPECT_EQ(Sum(res), 8);
+    }
+}
+
+}  // namespace lodash::container::test
@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "lodash/container/static_vector.h"
+#include "lodash/lodash.h"
+
+namespace lodash::container::test {
+
+class StaticVectorTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+};
+
+TEST_F(StaticVectorTest, basic) {
+    auto v = StaticVector<std::string, 3>();
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(v.capacity(), 3);
+
+    v.push_back("a");
+    v.push_back(std::string("b"));
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_EQ(v.front(), "a");
+    EXPECT_EQ(v.back(), "b");
+    EXPECT_EQ(std::vector<std::string>(v.begin(), v.end()), std::vector<std::string>({"a", "b"}));
+
+    v.pop_back();
+    v.resize(3);
+    EXPECT_EQ(v[2], "");
+    EXPECT_THROW(v.push_back("d"), std::length_error);
+    EXPECT_THROW(v.resize(4), std::length_error);
+
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
+
+TEST_F(StaticVectorTest, constexpr) {
+    constexpr auto v = [] {
+        auto res = StaticVector<int, 4>();
+        res.push_back(1);
+        res.push_back(2);
+        return res;
+    }();
+
+    static_assert(v.size() == 2 && v[1] == 2);
+    static_assert(v != StaticVector<int, 4>());
+}
+
+// The algorithms keeping a subset of a std::array return a StaticVector of the same capacity.
+TEST_F(StaticVectorTest, result_container) {
+    auto t = std::array<int, 6>({3, 1, 3, 2, 0, 1});
+
+    {
+        auto res = Uniq(t);
+        EXPECT_TRUE((std::is_same_v<decltype(res), StaticVector<int, 6>>));
+        EXPECT_EQ(std::vector<int>(res.begin(), res.end()), std::vector<int>({3, 1, 2, 0}));
+    }
+
+    {
+        auto res = Compact(t);
+        EXPECT_EQ(std::vector<int>(res.begin(), res.end()), std::vector<int>({3, 1, 3, 2, 1}));
+    }
+
+    {
+        auto res = Reject(t, Lt(2));
+        EXPECT_EQ(std::vector<int>(res.begin(), res.end()), std::vector<int>({3, 3, 2}));
+    }
+}
+
+}  // namespace lodash::container::test
@@ -0,0 +1,220 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "lodash/lodash.h"
+
+namespace lodash::test {
+
+class ExecutionTest : public testing::Test {
+protected:
+    virtual void SetUp() override {
+        t = Range(100000);
+    }
+
+    std::vector<int32_t> t;
+    Executor executor{3};
+    execution::ParallelPolicy policy = par.WithGrainSize(1000).WithMaxConcurrency(8).WithExecutor(executor);
+};
+
+TEST_F(ExecutionTest, Chunk) {
+    EXPECT_EQ(type_utility::GetChunkCount(policy, 0), 0);
+    EXPECT_EQ(type_utility::GetChunkCount(policy, 1), 1);
+    EXPECT_EQ(type_utility::GetChunkCount(policy, 1000), 1);
+    EXPECT_EQ(type_utility::GetChunkCount(policy, 1001), 2);
+    EXPECT_EQ(type_utility::GetChunkCount(policy, 100000), 8);
+    EXPECT_EQ(type_utility::GetChunkCount(policy.WithMaxConcurrency(0), 100000), 4);
+
+    EXPECT_EQ(type_utility::GetChunkBegin(0, 3, 10), 0);
+    EXPECT_EQ(type_utility::GetChunkBegin(1, 3, 10), 4);
+    EXPECT_EQ(type_utility::GetChunkBegin(2, 3, 10), 7);
+    EXPECT_EQ(type_utility::GetChunkBegin(3, 3, 10), 10);
+}
+
+TEST_F(ExecutionTest, Map) {
+    auto f = [](int x) {
+        return int64_t(x) * 2;
+    };
+
+    EXPECT_EQ(Map(policy, t, f), Map(t, f));
+    EXPECT_EQ(Map(seq, t, f), Map(t, f));
+
+    {
+        auto g = [](int x, size_t ix) {
+            return std::to_string(x) + "-" + std::to_string(ix);
+        };
+
+        EXPECT_EQ(Map(policy, t, g), Map(t, g));
+    }
+
+    {
+        auto res = Map<std::deque<int64_t>>(policy, t, f);
+        EXPECT_EQ(res, Map<std::deque<int64_t>>(t, f));
+    }
+
+    {
+        auto l = std::list<int>(t.begin(), t.end());
+        EXPECT_EQ(Map(policy, l, f), Map(t, f));
+    }
+}
+
+TEST_F(ExecutionTest, Filter) {
+    auto f = [](int x) {
+        return x % 3 == 0;
+    };
+
+    EXPECT_EQ(Filter(policy, t, f), Filter(t, f));
+    EXPECT_EQ(Filter(seq, t, f), Filter(t, f));
+
+    // The inputs which cannot be built give the result of the sequential Filter.
+    {
+        const auto a = RangeArray<10000>();
+        EXPECT_EQ(Filter(policy, a, f), Filter(a, f));
+    }
+
+    {
+        auto r = RangeView(100000);
+        EXPECT_EQ(Filter(policy, r, f), Filter(t, f));
+    }
+}
+
+TEST_F(ExecutionTest, Reduce) {
+    auto f = [](int64_t pre, int64_t x) {
+        return pre + x;
+    };
+
+    EXPECT_EQ(Reduce(policy, t, f, int64_t(0)), 4999950000);
+    EXPECT_EQ(Reduce(seq, t, f, int64_t(0)), 4999950000);
+}
+
+TEST_F(ExecutionTest, ReduceParallel) {
+    auto f = [](int64_t pre, int64_t x) {
+        return pre + x;
+    };
+
+    auto combine = std::plus<int64_t>();
+
+    EXPECT_EQ(ReduceParallel(policy, t, f, int64_t(0), combine), 4999950000);
+    EXPECT_EQ(ReduceParallel(seq, t, f, int64_t(0), combine), 4999950000);
+    EXPECT_EQ(ReduceParallel(t, f, int64_t(0), combine), 4999950000);
+
+    {
+        auto l = std::list<int>(t.begin(), t.begin() + 100);
+        EXPECT_EQ(ReduceParallel(policy, l, f, int64_t(0), combine), 4950);
+    }
+
+    // The partial results of the 8 chunks are combined in a balanced tree, in order.
+    {
+        auto res = ReduceParallel(
+                policy,
+                t,
+                [](std::string s, int x) {
+                    return x % 12500 == 0 ? s + std::to_string(x / 12500) : s;
+                },
+                std::string(),
+                [](const std::string& a, const std::string& b) {
+                    return "(" + a + b + ")";
+                });
+
+        EXPECT_EQ(res, "(((01)(23))((45)(67)))");
+    }
+
+    // The chunks do not depend on the scheduling, neither does a floating-point result.
+    {
+        auto v = Map(t, [](int x) {
+            return 1.0 / (x + 1);
+        });
+
+        auto sum = [](double pre, double x) {
+            return pre + x;
+        };
+
+        auto res = ReduceParallel(policy, v, sum, 0.0, std::plus<double>());
+        for (int i = 0; i < 10; i++) {
+            EXPECT_EQ(ReduceParallel(policy, v, sum, 0.0, std::plus<double>()), res);
+        }
+    }
+}
+
+TEST_F(ExecutionTest, TransformReduce) {
+    auto square = [](int x) {
+        return int64_t(x) * x;
+    };
+
+    auto expected = int64_t(0);
+    for (auto x : t) {
+        expected += square(x);
+    }
+
+    EXPECT_EQ(TransformReduce(policy, t, square, std::plus<int64_t>(), int64_t(0)), expected);
+    EXPECT_EQ(TransformReduce(seq, t, square, std::plus<int64_t>(), int64_t(0)), expected);
+    EXPECT_EQ(TransformReduce(t, square, std::plus<int64_t>(), int64_t(1)), expected + 1);
+
+    // init is combined once, it needs not be the identity of combine.
+    {
+        auto res = TransformReduce(
+                policy,
+                t,
+                [](int x, size_t ix) {
+                    return int64_t(x) - int64_t(ix);
+                },
+                std::plus<int64_t>(),
+                int64_t(7));
+
+        EXPECT_EQ(res, 7);
+    }
+
+    {
+        auto m = std::map<std::string, int>({{"a", 1}, {"b", 2}});
+        auto res = TransformReduce(
+                m,
+                [](const std::string& k, int v) {
+                    return k + std::to_string(v);
+                },
+                std::plus<std::string>(),
+                std::string(">"));
+
+        EXPECT_EQ(res, ">a1b2");
+    }
+}
+
+TEST_F(ExecutionTest, CountBy) {
+    auto f = [](int x) {
+        return x % 7 == 0;
+    };
+
+    EXPECT_EQ(CountBy(policy, t, f), CountBy(t, f));
+    EXPECT_EQ(CountBy(par, t, f), CountBy(t, f));
+}
+
+TEST_F(ExecutionTest, SumBy) {
+    auto v = std::vector<int64_t>(t.begin(), t.end());
+    auto f = [](int64_t x) {
+        return x * 2;
+    };
+
+    EXPECT_EQ(SumBy(policy, v, f), SumBy(v, f));
+    EXPECT_EQ(SumBy(policy, v, f), 9999900000);
+}
+
+TEST_F(ExecutionTest, Exception) {
+    EXPECT_THROW(CountBy(policy,
+                         t,
+                         [](int x) -> bool {
+                             if (x == 99999) {
+                                 throw std::runtime_error("boom");
+                             }
+
+                             return true;
+                         }),
+                 std::runtime_error);
+}
+
+}  // namespace lodash::test
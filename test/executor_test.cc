@@ -0,0 +1,143 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "lodash/lodash.h"
+
+namespace lodash::test {
+
+class ExecutorTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+};
+
+TEST_F(ExecutorTest, ParallelFor) {
+    auto executor = Executor(4);
+    EXPECT_EQ(executor.WorkerCount(), 4);
+    EXPECT_EQ(executor.Concurrency(), 5);
+
+    {
+        auto visited = std::vector<int>(1000);
+        executor.ParallelFor(visited.size(), [&visited](size_t ix) {
+            visited[ix] += static_cast<int>(ix);
+        });
+
+        for (size_t i = 0; i < visited.size(); i++) {
+            EXPECT_EQ(visited[i], static_cast<int>(i));
+        }
+    }
+
+    {
+        auto count = std::atomic<size_t>(0);
+        executor.ParallelFor(0, [&count]([[maybe_unused]] size_t ix) {
+            ++count;
+        });
+
+        EXPECT_EQ(count.load(), 0);
+    }
+}
+
+TEST_F(ExecutorTest, NoWorker) {
+    auto executor = Executor(0);
+    auto thread_id = std::this_thread::get_id();
+    auto same_thread = true;
+
+    executor.ParallelFor(100, [&thread_id, &same_thread]([[maybe_unused]] size_t ix) {
+        same_thread = same_thread && std::this_thread::get_id() == thread_id;
+    });
+
+    EXPECT_TRUE(same_thread);
+}
+
+TEST_F(ExecutorTest, Nested) {
+    auto executor = Executor(3);
+    auto count = std::atomic<size_t>(0);
+
+    executor.ParallelFor(16, [&executor, &count]([[maybe_unused]] size_t i) {
+        executor.ParallelFor(64, [&count]([[maybe_unused]] size_t j) {
+            ++count;
+        });
+    });
+
+    EXPECT_EQ(count.load(), 16 * 64);
+}
+
+TEST_F(ExecutorTest, Concurrent) {
+    auto executor = Executor(2);
+    auto count = std::atomic<size_t>(0);
+    auto threads = std::vector<std::thread>();
+
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&executor, &count] {
+            for (int k = 0; k < 10; k++) {
+                executor.ParallelFor(100, [&count]([[maybe_unused]] size_t ix) {
+                    ++count;
+                });
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(count.load(), 4 * 10 * 100);
+}
+
+// The caller waiting for the chunks of a worker sleeps rather than spinning on the queues.
+TEST_F(ExecutorTest, WaitDoesNotSpin) {
+    auto executor = Executor(1);
+    auto caller = std::this_thread::get_id();
+
+    // Let the worker go idle, so that the caller hands off the second index.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    auto thread_cpu_ms = [] {
+        auto ts = timespec{};
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+    };
+
+    auto before = thread_cpu_ms();
+    auto on_worker = std::atomic<bool>(false);
+    executor.ParallelFor(2, [caller, &on_worker]([[maybe_unused]] size_t ix) {
+        if (std::this_thread::get_id() != caller) {
+            on_worker = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+    });
+    auto spent = thread_cpu_ms() - before;
+
+    if (on_worker) {
+        EXPECT_LT(spent, 100.0);
+    }
+}
+
+TEST_F(ExecutorTest, Exception) {
+    auto executor = Executor(2);
+    auto count = std::atomic<size_t>(0);
+
+    EXPECT_THROW(executor.ParallelFor(100,
+                                      [&count](size_t ix) {
+                                          ++count;
+                                          if (ix % 10 == 0) {
+                                              throw std::runtime_error("boom");
+                                          }
+                                      }),
+                 std::runtime_error);
+
+    EXPECT_EQ(count.load(), 100);
+}
+
+TEST_F(ExecutorTest, Default) {
+    EXPECT_EQ(&Executor::Default(), &Executor::Default());
+    EXPECT_EQ(Executor::Default().WorkerCount(), Executor::DefaultWorkerCount());
+}
+
+}  // namespace lodash::test
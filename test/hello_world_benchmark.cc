@@ -1,8 +0,0 @@
-#include "benchmark/benchmark.h"
-
-static void BenchmarkHelloWorld(benchmark::State& state) {
-    for (auto _ : state) {
-    }
-}
-
-BENCHMARK(BenchmarkHelloWorld);
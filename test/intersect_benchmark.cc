@@ -0,0 +1,91 @@
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_set>
+#include <utility>
+
+#include "./benchmark_util.h"
+#include "lodash/lodash.h"
+
+namespace lodash::bench {
+
+namespace {
+
+// MakeInputPair returns two inputs of n elements, the values of the second one are shifted by n / 2 so about half of
+// them are also in the first one.
+template <typename Container>
+std::pair<Container, Container> MakeInputPair(size_t n) {
+    return {MakeInput<Container>(n), MakeInput<Container>(n, n / 2)};
+}
+
+template <typename Container>
+void RegisterSequenceSuite() {
+    using T = typename Container::value_type;
+    using Input = std::pair<Container, Container>;
+
+    RegisterPair<Container>(
+            "Intersect",
+            MakeInputPair<Container>,
+            [](const Input& t) {
+                return Intersect(t.first, t.second);
+            },
+            [](const Input& t) {
+                auto se = std::unordered_set<T>(t.first.begin(), t.first.end());
+                auto res = Container();
+                for (auto&& v : t.second) {
+                    if (se.erase(v) > 0) {
+                        res.push_back(v);
+                    }
+                }
+
+                return res;
+            });
+
+    RegisterPair<Container>(
+            "Union",
+            MakeInputPair<Container>,
+            [](const Input& t) {
+                return Union(t.first, t.second);
+            },
+            [](const Input& t) {
+                auto se = std::unordered_set<T>();
+                se.reserve(t.first.size() + t.second.size());
+
+                auto res = Container();
+                for (auto* c : {&t.first, &t.second}) {
+                    for (auto&& v : *c) {
+                        if (se.insert(v).second) {
+                            res.push_back(v);
+                        }
+                    }
+                }
+
+                return res;
+            });
+
+    // The element looked for is absent, so both scan the whole input.
+    RegisterPair<Container>(
+            "Contains",
+            [](size_t n) {
+                return std::make_pair(MakeInput<Container>(n), MakeValue<T>(n));
+            },
+            [](const std::pair<Container, T>& t) {
+                return Contains(t.first, t.second);
+            },
+            [](const std::pair<Container, T>& t) {
+                return std::find(t.first.begin(), t.first.end(), t.second) != t.first.end();
+            });
+}
+
+[[maybe_unused]] const bool kRegistered = [] {
+    ForEachSequenceContainer([](auto c) {
+        RegisterSequenceSuite<decltype(c)>();
+    });
+
+    return true;
+}();
+
+}  // namespace
+
+}  // namespace lodash::bench
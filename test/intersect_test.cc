@@ -1,7 +1,12 @@
 #include "gtest/gtest.h"
 #include "snapshot/snapshot.h"
 
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <list>
 #include <map>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -32,6 +37,22 @@ TEST_F(IntersectTest, Contains) {
     }
 }
 
+
+TEST_F(IntersectTest, ContainsConstexpr) {
+    constexpr auto t = std::array<int, 6>({1, 2, 3, 4, 5, 6});
+
+    static_assert(Contains(t, 3));
+    static_assert(!Contains(t, 7));
+    static_assert(ContainsBy(t, Gt(5)));
+    static_assert(!ContainsBy(t, [](int v) {
+        return v > 6;
+    }));
+
+    auto u = t;
+    EXPECT_TRUE(Contains(u, 6));
+    EXPECT_FALSE(ContainsBy(u, Lt(1)));
+}
+
 TEST_F(IntersectTest, Every) {
     {
         auto t = std::vector<int>({1, 2, 3, 4, 5});
@@ -190,6 +211,146 @@ TEST_F(IntersectTest, Union) {
             EXPECT_EQ(res, expected);
         }
     }
+
+    {
+        auto t1 = std::vector<int>({5, 3, 5, 1});
+        auto t2 = std::vector<int>({4, 1, 2, 4});
+
+        {
+            auto res = Union(t1, t2);
+            auto expected = std::vector<int>({5, 3, 1, 4, 2});
+            EXPECT_EQ(res, expected);
+        }
+    }
+
+    {
+        auto t1 = std::vector<std::vector<int>>({{1}, {2}});
+        auto t2 = std::vector<std::vector<int>>({{2}, {3}});
+
+        {
+            auto res = Union(t1, t2);
+            auto expected = std::vector<std::vector<int>>({{1}, {2}, {3}});
+            EXPECT_EQ(res, expected);
+
+            res = Intersect(t1, t2);
+            expected = std::vector<std::vector<int>>({{2}});
+            EXPECT_EQ(res, expected);
+        }
+    }
+}
+
+TEST_F(IntersectTest, Rvalue) {
+    {
+        auto t1 = std::vector<std::string>({"a", "b", "c", "a"});
+        auto t2 = std::vector<std::string>({"c", "d", "a", "d"});
+        auto data = t1.data();
+
+        auto res = Union(std::move(t1), std::move(t2));
+        EXPECT_EQ(res, std::vector<std::string>({"a", "b", "c", "d"}));
+        EXPECT_EQ(res.data(), data);
+    }
+
+    {
+        auto t1 = std::vector<std::string>({"a", "b", "c"});
+        auto t2 = std::vector<std::string>({"c", "d", "a", "c"});
+        auto data = t2.data();
+
+        auto res = Intersect(std::move(t1), std::move(t2));
+        EXPECT_EQ(res, std::vector<std::string>({"c", "a"}));
+        EXPECT_EQ(res.data(), data);
+    }
+}
+
+TEST_F(IntersectTest, IntersectSorted) {
+    {
+        auto t1 = std::vector<int>({1, 2, 2, 3, 5, 8});
+        auto t2 = std::vector<int>({2, 2, 3, 4, 8, 9});
+
+        auto res = IntersectSorted(t1, t2);
+        auto expected = std::vector<int>({2, 3, 8});
+        EXPECT_EQ(res, expected);
+    }
+
+    {
+        auto t1 = std::list<int>({1, 3, 5, 7});
+        auto t2 = std::list<int>({3, 4, 5, 6});
+
+        auto res = IntersectSorted(t1, t2);
+        auto expected = std::list<int>({3, 5});
+        EXPECT_EQ(res, expected);
+    }
+
+    {
+        auto t1 = std::vector<int>({9, 7, 5, 3});
+        auto t2 = std::vector<int>({8, 7, 3, 1});
+
+        auto res = IntersectSorted(t1, t2, std::greater<>());
+        auto expected = std::vector<int>({7, 3});
+        EXPECT_EQ(res, expected);
+    }
+
+    {
+        auto t1 = std::vector<int>();
+        auto t2 = std::vector<int>({1, 2});
+        EXPECT_TRUE(IntersectSorted(t1, t2).empty());
+        EXPECT_TRUE(IntersectSorted(t2, t1).empty());
+    }
+
+    {
+        auto rnd = std::mt19937(42);
+
+        for (size_t n1 : {1, 3, 10, 100}) {
+            for (size_t n2 : {1, 50, 1000, 10000}) {
+                auto t1 = std::vector<int>(n1);
+                auto t2 = std::vector<int>(n2);
+                for (auto& x : t1) {
+                    x = static_cast<int>(rnd() % 2000);
+                }
+                for (auto& x : t2) {
+                    x = static_cast<int>(rnd() % 2000);
+                }
+
+                std::sort(t1.begin(), t1.end());
+                std::sort(t2.begin(), t2.end());
+
+                auto expected = std::vector<int>();
+                std::set_intersection(t1.begin(), t1.end(), t2.begin(), t2.end(), std::back_inserter(expected));
+                expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+                EXPECT_EQ(IntersectSorted(t1, t2), expected);
+                EXPECT_EQ(IntersectSorted(t2, t1), expected);
+            }
+        }
+    }
+}
+
+TEST_F(IntersectTest, UnionSorted) {
+    {
+        auto t1 = std::vector<int>({1, 2, 2, 3, 5});
+        auto t2 = std::vector<int>({0, 2, 4, 5, 5, 6});
+
+        auto res = UnionSorted(t1, t2);
+        auto expected = std::vector<int>({0, 1, 2, 3, 4, 5, 6});
+        EXPECT_EQ(res, expected);
+    }
+
+    {
+        auto t1 = std::list<std::string>({"a", "c"});
+        auto t2 = std::list<std::string>({"b", "c", "d"});
+
+        auto res = UnionSorted(t1, t2);
+        auto expected = std::list<std::string>({"a", "b", "c", "d"});
+        EXPECT_EQ(res, expected);
+    }
+
+    {
+        auto t1 = std::vector<int>({5, 3, 1});
+        auto t2 = std::vector<int>({4, 3, 2});
+
+        auto res = UnionSorted(t1, t2, std::greater<>());
+        auto expected = std::vector<int>({5, 4, 3, 2, 1});
+        EXPECT_EQ(res, expected);
+    }
 }
 
 }  // namespace lodash::test
@@ -0,0 +1,79 @@
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "./benchmark_util.h"
+#include "lodash/lodash.h"
+
+namespace lodash::bench {
+
+namespace {
+
+template <typename Container>
+void RegisterSumSuite() {
+    using T = typename Container::value_type;
+
+    RegisterPair<Container>(
+            "Sum",
+            [](const Container& c) {
+                return Sum(c);
+            },
+            [](const Container& c) {
+                return std::accumulate(c.begin(), c.end(), T());
+            });
+
+    // The accurate sums are measured against the same naive left-to-right sum.
+    if constexpr (std::is_floating_point_v<T>) {
+        RegisterPair<Container>(
+                "SumPairwise",
+                [](const Container& c) {
+                    return SumPairwise(c);
+                },
+                [](const Container& c) {
+                    return std::accumulate(c.begin(), c.end(), T());
+                });
+
+        RegisterPair<Container>(
+                "SumKahan",
+                [](const Container& c) {
+                    return SumKahan(c);
+                },
+                [](const Container& c) {
+                    return std::accumulate(c.begin(), c.end(), T());
+                });
+    }
+}
+
+[[maybe_unused]] const bool kRegistered = [] {
+    ForEachSequenceContainer([](auto c) {
+        using Container = decltype(c);
+
+        if constexpr (std::is_arithmetic_v<typename Container::value_type>) {
+            RegisterSumSuite<Container>();
+        }
+    });
+
+    RegisterPair<std::vector<int32_t>>(
+            "Range",
+            [](size_t n) {
+                return static_cast<int32_t>(n);
+            },
+            [](int32_t n) {
+                return Range(n);
+            },
+            [](int32_t n) {
+                auto res = std::vector<int32_t>(n);
+                std::iota(res.begin(), res.end(), 0);
+                return res;
+            });
+
+    return true;
+}();
+
+}  // namespace
+
+}  // namespace lodash::bench
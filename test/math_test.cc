@@ -1,8 +1,15 @@
 #include "gtest/gtest.h"
 #include "snapshot/snapshot.h"
 
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <list>
 #include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "lodash/lodash.h"
@@ -75,6 +82,78 @@ TEST_F(MathTest, Range) {
         }
         EXPECT_EQ(res, 45);
     }
+
+    {
+        EXPECT_TRUE(Range(10, 20, 0).empty());
+        EXPECT_TRUE(Range(10, 20, -1).empty());
+        EXPECT_TRUE(Range(20, 10, 1).empty());
+        EXPECT_EQ(Range(10, 21, 5), std::vector<int32_t>({10, 15, 20}));
+    }
+
+    {
+        EXPECT_EQ(Range(uint32_t(3)), std::vector<uint32_t>({0, 1, 2}));
+        EXPECT_EQ(Range(uint32_t(3), uint32_t(0)), std::vector<uint32_t>({3, 2, 1}));
+        EXPECT_EQ(Range(uint8_t(250), uint8_t(255), uint8_t(2)), std::vector<uint8_t>({250, 252, 254}));
+        EXPECT_EQ(Range(uint64_t(10), uint64_t(0), uint64_t(-4)), std::vector<uint64_t>({10, 6, 2}));
+    }
+
+    {
+        auto t = Range(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), 1 << 30);
+        EXPECT_EQ(t, std::vector<int32_t>({-(1 << 30) * 2, -(1 << 30), 0, 1 << 30}));
+    }
+
+    {
+        auto t = Range(0.0, 1.0, 0.1);
+        ASSERT_EQ(t.size(), 10);
+        EXPECT_EQ(t[0], 0.0);
+        EXPECT_DOUBLE_EQ(t[9], 0.9);
+        EXPECT_TRUE(Range(0.0, 1.0, 0.0).empty());
+    }
+
+    for (int n : {0, 1, 7, 8, 9, 17, 100, 1001}) {
+        auto t = Range(5, 5 + 3 * n, 3);
+        ASSERT_EQ(t.size(), n);
+        for (int i = 0; i < n; i++) {
+            EXPECT_EQ(t[i], 5 + 3 * i);
+        }
+
+        auto u = Range(int64_t(-n), int64_t(-3 * n), int64_t(-2));
+        EXPECT_EQ(u, std::vector<int64_t>(RangeView(int64_t(-n), int64_t(-3 * n), int64_t(-2)).begin(),
+                                           RangeView(int64_t(-n), int64_t(-3 * n), int64_t(-2)).end()));
+    }
+}
+
+TEST_F(MathTest, RangeView) {
+    for (auto [start, stop, step] : std::vector<std::tuple<int, int, int>>{
+                 {0, 10, 1}, {10, 0, -1}, {10, 20, 5}, {20, 10, -5}, {10, 21, 5}, {10, 20, 0}, {10, 20, -1}}) {
+        auto view = RangeView(start, stop, step);
+        EXPECT_EQ(std::vector<int>(view.begin(), view.end()), Range(start, stop, step));
+        EXPECT_EQ(view.size(), Range(start, stop, step).size());
+    }
+
+    EXPECT_EQ(RangeView(5).size(), 5);
+    EXPECT_EQ(RangeView(-5).back(), -4);
+    EXPECT_EQ(RangeView(3, 7).front(), 3);
+}
+
+TEST_F(MathTest, Constexpr) {
+    constexpr auto t = std::array<int32_t, 5>({1, 2, 3, 4, std::numeric_limits<int32_t>::max()});
+
+    static_assert(Sum(RangeArray<5>(1)) == 15);
+    static_assert(Sum<int64_t>(t) == int64_t(10) + std::numeric_limits<int32_t>::max());
+    static_assert(SumBy(RangeArray<4>(), [](int32_t v) {
+                      return v * v;
+                  }) == 14);
+    static_assert(Sum(std::array<double, 3>({0.5, 0.25, 0.125})) == 0.875);
+
+    static_assert(RangeArray<3>(10, -5)[0] == 10 && RangeArray<3>(10, -5)[2] == 0);
+    static_assert(RangeView(10, 0).size() == 10 && RangeView(10, 0)[9] == 1);
+    static_assert(Clamp(5, 0, 3) == 3);
+
+    // The run time calls take the vectorized path.
+    auto u = t;
+    EXPECT_EQ(Sum<int64_t>(u), int64_t(10) + std::numeric_limits<int32_t>::max());
+    EXPECT_EQ(Sum(RangeArray<1000>()), 999 * 1000 / 2);
 }
 
 TEST_F(MathTest, Clamp) {
@@ -103,4 +182,165 @@ TEST_F(MathTest, Sum) {
     }
 }
 
+TEST_F(MathTest, SumKernel) {
+    for (int n : {0, 1, 3, 7, 8, 15, 16, 17, 63, 64, 65, 1000, 1023}) {
+        {
+            auto t = Range<int32_t>(-n / 2, n - n / 2);
+            EXPECT_EQ(Sum(t), (n - n / 2 - 1) * (n - n / 2) / 2 - (n / 2) * (n / 2 + 1) / 2);
+        }
+
+        {
+            auto t = std::vector<int64_t>(n, int64_t(3e9));
+            EXPECT_EQ(Sum(t), int64_t(3e9) * n);
+        }
+
+        {
+            auto t = std::vector<uint32_t>(n, 7);
+            EXPECT_EQ(Sum(t), uint32_t(7 * n));
+        }
+
+        {
+            auto t = std::vector<double>(n, 0.5);
+            EXPECT_DOUBLE_EQ(Sum(t), 0.5 * n);
+        }
+
+        {
+            auto t = std::vector<float>(n, 0.25f);
+            EXPECT_FLOAT_EQ(Sum(t), 0.25f * float(n));
+        }
+
+        {
+            auto t = std::vector<int16_t>(n, 2);
+            EXPECT_EQ(Sum(t), int16_t(2 * n));
+            EXPECT_EQ(Sum<int32_t>(t), 2 * n);
+            EXPECT_EQ(SumBy(t,
+                            [](int16_t v) {
+                                return v;
+                            }),
+                      int16_t(2 * n));
+        }
+
+        {
+            auto t = std::vector<int8_t>(n, 5);
+            EXPECT_EQ(Sum(t), int8_t(5 * n));
+            EXPECT_EQ(Sum<int32_t>(t), 5 * n);
+            EXPECT_EQ(SumBy(t,
+                            [](int8_t v) {
+                                return v;
+                            }),
+                      int8_t(5 * n));
+        }
+
+        {
+            auto t = std::vector<int32_t>(n, 3);
+            EXPECT_EQ(SumBy(t,
+                            [](int32_t& v) {
+                                return v * 2;
+                            }),
+                      6 * n);
+        }
+    }
+
+    {
+        auto t = std::array<double, 5>({1.5, 2.5, 3.5, 4.5, 5.5});
+        EXPECT_DOUBLE_EQ(Sum(t), 17.5);
+    }
+
+    {
+        auto t = std::deque<int>({1, 2, 3, 4, 5});
+        EXPECT_EQ(Sum(t), 15);
+    }
+
+    {
+        auto t = std::vector<std::string>({"a", "b", "c"});
+        EXPECT_EQ(Sum(t), "abc");
+    }
+}
+
+TEST_F(MathTest, SumAccumulator) {
+    const auto n = 1000;
+    const auto t = std::vector<int32_t>(n, std::numeric_limits<int32_t>::max());
+    const auto expected = int64_t(std::numeric_limits<int32_t>::max()) * n;
+
+    EXPECT_EQ(Sum<int64_t>(t), expected);
+    EXPECT_EQ(Sum<int64_t>(std::deque<int32_t>(t.begin(), t.end())), expected);
+    EXPECT_EQ(SumPairwise<int64_t>(t), expected);
+
+    auto f = [](int32_t v) {
+        return v;
+    };
+
+    EXPECT_EQ(SumBy<int64_t>(t, f), expected);
+    EXPECT_EQ(SumBy<int64_t>(par.WithGrainSize(100), t, f), expected);
+    EXPECT_EQ(SumPairwiseBy<int64_t>(t, f), expected);
+
+    {
+        auto res = Sum<double>(std::vector<float>({0.5f, 0.25f}));
+        EXPECT_TRUE((std::is_same_v<decltype(res), double>));
+        EXPECT_EQ(res, 0.75);
+    }
+
+    // A container of non-arithmetic values is summed in the result type of f.
+    {
+        auto u = std::vector<std::pair<int, double>>({{1, 0.5}, {2, 1.5}});
+        auto res = SumBy(u, [](const std::pair<int, double>& p) {
+            return p.second;
+        });
+
+        EXPECT_TRUE((std::is_same_v<decltype(res), double>));
+        EXPECT_EQ(res, 2.0);
+    }
+}
+
+TEST_F(MathTest, SumPrecision) {
+    // The double closest to 0.1 times 10^6 rounds to 100000, a left-to-right sum is off by about 1e-6.
+    const auto n = 1000000;
+    const auto t = std::vector<double>(n, 0.1);
+
+    {
+        auto res = 0.0;
+        for (auto v : t) {
+            res += v;
+        }
+
+        EXPECT_GT(std::abs(res - 1e5), 1e-7);
+    }
+
+    EXPECT_EQ(SumKahan(t), 1e5);
+    EXPECT_EQ(SumKahan(std::list<double>(t.begin(), t.end())), 1e5);
+    EXPECT_NEAR(SumPairwise(t), 1e5, 1e-9);
+    EXPECT_NEAR(SumPairwise(std::deque<double>(t.begin(), t.end())), 1e5, 1e-9);
+
+    EXPECT_EQ(SumKahanBy(t,
+                         [](double v) {
+                             return v * 2;
+                         }),
+              2e5);
+
+    {
+        auto u = std::vector<float>(n, 0.1f);
+        EXPECT_NEAR(SumPairwise(u), 0.1f * n, 0.1f * n * 1e-5f);
+        EXPECT_NEAR(SumKahan<double>(u), 0.1 * n, 1);
+    }
+
+    // The compensation also recovers the small terms absorbed by the large ones.
+    EXPECT_EQ(SumKahan(std::vector<double>({1e100, 1.0, -1e100})), 1.0);
+
+    EXPECT_EQ(SumPairwise(std::vector<double>()), 0.0);
+    EXPECT_EQ(SumKahan(std::vector<double>()), 0.0);
+}
+
+// SumPairwise adds the blocks of the same values in the same tree whatever the container.
+TEST_F(MathTest, SumPairwise) {
+    for (auto n : {1, 511, 512, 513, 5000}) {
+        auto t = std::vector<int64_t>();
+        for (int i = 0; i < n; i++) {
+            t.push_back(i);
+        }
+
+        EXPECT_EQ(SumPairwise(t), int64_t(n) * (n - 1) / 2);
+        EXPECT_EQ(SumPairwise(std::list<int64_t>(t.begin(), t.end())), int64_t(n) * (n - 1) / 2);
+    }
+}
+
 }  // namespace lodash::test
@@ -0,0 +1,216 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "lodash/lodash.h"
+#include "lodash/type_utility/memory_resource.h"
+
+namespace lodash::test {
+
+// The arena has no upstream, so any allocation which does not come from it throws std::bad_alloc.
+class MemoryResourceTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+
+    std::array<std::byte, 1 << 16> buffer;
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    template <typename Container>
+    bool IsFromArena(const Container& c) {
+        return c.get_allocator().resource() == &arena;
+    }
+};
+
+TEST_F(MemoryResourceTest, rebind_pmr) {
+    EXPECT_TRUE((std::is_same_v<type_utility::rebind_pmr_t<std::vector<int>>, std::pmr::vector<int>>));
+    EXPECT_TRUE((std::is_same_v<type_utility::rebind_pmr_t<std::string>, std::pmr::string>));
+    EXPECT_TRUE((std::is_same_v<type_utility::rebind_pmr_t<std::set<int>>, std::pmr::set<int>>));
+    EXPECT_TRUE((std::is_same_v<type_utility::rebind_pmr_t<std::map<int, int>>, std::pmr::map<int, int>>));
+    EXPECT_TRUE((std::is_same_v<type_utility::rebind_pmr_t<std::array<int, 3>>, std::array<int, 3>>));
+    EXPECT_TRUE((std::is_same_v<type_utility::rebind_pmr_t<std::pmr::vector<int>>, std::pmr::vector<int>>));
+    EXPECT_TRUE((std::is_same_v<type_utility::rebind_container_t<std::vector<int>, type_utility::DefaultResource>,
+                                std::vector<int>>));
+}
+
+TEST_F(MemoryResourceTest, Slice) {
+    const auto t = std::vector<int>({1, 0, 2, 2, 3, 0, 4, 5, 5});
+
+    {
+        auto res = Map(&arena, t, [](int x) {
+            return x * 2;
+        });
+
+        EXPECT_TRUE((std::is_same_v<decltype(res), std::pmr::vector<int>>));
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({2, 0, 4, 4, 6, 0, 8, 10, 10}));
+    }
+
+    {
+        auto res = Map<std::pmr::vector<std::pmr::string>>(&arena, t, [](int x) {
+            return std::to_string(x);
+        });
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_TRUE(IsFromArena(res[0]));
+        EXPECT_EQ(res[8], "5");
+    }
+
+    {
+        auto res = Filter(&arena, t, [](int x) {
+            return x % 2 == 0;
+        });
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({0, 2, 2, 0, 4}));
+    }
+
+    {
+        auto res = Reject(&arena, t, [](int x) {
+            return x % 2 == 0;
+        });
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({1, 3, 5, 5}));
+    }
+
+    {
+        auto res = Uniq(&arena, t);
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({1, 0, 2, 3, 4, 5}));
+    }
+
+    {
+        auto res = UniqBy(&arena, t, [](int x) {
+            return x % 3;
+        });
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({1, 0, 2}));
+    }
+
+    {
+        auto res = Compact(&arena, t);
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({1, 2, 2, 3, 4, 5, 5}));
+    }
+
+    {
+        auto res = ReplaceAll(&arena, std::string("a-b-c"), '-', '+');
+
+        EXPECT_TRUE((std::is_same_v<decltype(res), std::pmr::string>));
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, "a+b+c");
+    }
+
+    {
+        auto res = Flatten(&arena, std::vector<std::vector<int>>({{1, 2}, {}, {3}}));
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({1, 2, 3}));
+    }
+
+    {
+        auto res = Times(&arena, 3, [](size_t i) {
+            return i * i;
+        });
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<size_t>({0, 1, 4}));
+    }
+}
+
+TEST_F(MemoryResourceTest, Set) {
+    const auto t = std::vector<std::string>({"a", "b", "c", "b"});
+
+    {
+        auto res = Uniq(&arena, t);
+
+        EXPECT_TRUE((std::is_same_v<decltype(res), std::pmr::vector<std::string>>));
+        EXPECT_EQ(res, std::pmr::vector<std::string>({"a", "b", "c"}));
+    }
+
+    {
+        auto res = Intersect(&arena, std::vector<int>({1, 2, 3}), std::vector<int>({3, 2, 5}));
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({3, 2}));
+    }
+
+    {
+        auto res = Union(&arena, std::vector<int>({1, 2, 3}), std::vector<int>({3, 2, 5}));
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({1, 2, 3, 5}));
+    }
+
+    {
+        auto res = IntersectSorted(&arena, std::vector<int>({1, 2, 3}), std::vector<int>({2, 3, 5}));
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({2, 3}));
+    }
+
+    {
+        auto res = UnionSorted(&arena, std::vector<int>({1, 2, 3}), std::vector<int>({2, 3, 5}));
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int>({1, 2, 3, 5}));
+    }
+
+    {
+        // std::vector<int> is not hashable, so the scratch set is a std::pmr::set.
+        auto res = Uniq(&arena, std::vector<std::vector<int>>({{1}, {2}, {1}}));
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res.size(), 2);
+    }
+}
+
+TEST_F(MemoryResourceTest, Rvalue) {
+    {
+        auto t = std::pmr::vector<int>({1, 2, 3, 4}, &arena);
+        auto data = t.data();
+
+        auto res = Filter(&arena, std::move(t), Gt(2));
+        EXPECT_EQ(res, std::pmr::vector<int>({3, 4}));
+        EXPECT_EQ(res.data(), data);
+    }
+
+    {
+        // The input allocates from another resource, so the result is a copy allocated from the arena.
+        auto t = std::pmr::vector<int>({1, 2, 3, 4});
+
+        auto res = Filter(&arena, std::move(t), Gt(2));
+        EXPECT_EQ(res, std::pmr::vector<int>({3, 4}));
+        EXPECT_TRUE(IsFromArena(res));
+    }
+}
+
+TEST_F(MemoryResourceTest, Range) {
+    {
+        auto res = Range(&arena, 5);
+
+        EXPECT_TRUE((std::is_same_v<decltype(res), std::pmr::vector<int32_t>>));
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int32_t>({0, 1, 2, 3, 4}));
+    }
+
+    {
+        auto res = Range<int64_t>(&arena, 4, 0, -2);
+
+        EXPECT_TRUE(IsFromArena(res));
+        EXPECT_EQ(res, std::pmr::vector<int64_t>({4, 2}));
+    }
+}
+
+}  // namespace lodash::test
@@ -0,0 +1,180 @@
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+#include "lodash/lodash.h"
+
+namespace {
+
+// CountingResource forwards to the default resource and counts the allocations, the `allocs` counter of the
+// benchmarks below is the number of allocations made by one call.
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t AllocationCount() const {
+        return allocation_count_;
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocation_count_;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    size_t allocation_count_{0};
+};
+
+std::vector<int> MakeInput(size_t n) {
+    return lodash::Times(n, [](size_t ix) {
+        return static_cast<int>(ix);
+    });
+}
+
+template <typename F>
+void RunCounted(benchmark::State& state, F&& f) {
+    CountingResource resource;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f(&resource));
+    }
+
+    state.counters["allocs"] =
+            benchmark::Counter(static_cast<double>(resource.AllocationCount()), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// MakeRandomInput returns values uniform in [-n, n), so the predicates `x > 0` and `x != 0` are true for about half of
+// them in an unpredictable pattern.
+std::vector<int> MakeRandomInput(size_t n) {
+    auto rnd = std::mt19937(42);
+    return lodash::Times(n, [&rnd, n](size_t) {
+        return static_cast<int>(rnd() % (2 * n)) - static_cast<int>(n);
+    });
+}
+
+// BenchmarkPushBack is the baseline: a std::pmr::vector grown by push_back without reserve.
+void BenchmarkPushBack(benchmark::State& state) {
+    auto t = MakeInput(state.range(0));
+    RunCounted(state, [&t](std::pmr::memory_resource* resource) {
+        auto res = std::pmr::vector<int>(resource);
+        for (auto&& v : t) {
+            res.push_back(v * 2);
+        }
+
+        return res;
+    });
+}
+
+void BenchmarkMap(benchmark::State& state) {
+    auto t = MakeInput(state.range(0));
+    RunCounted(state, [&t](std::pmr::memory_resource* resource) {
+        return lodash::Map(resource, t, [](int x) {
+            return x * 2;
+        });
+    });
+}
+
+void BenchmarkFilter(benchmark::State& state) {
+    auto t = MakeInput(state.range(0));
+    RunCounted(state, [&t](std::pmr::memory_resource* resource) {
+        return lodash::Filter(resource, t, [](int x) {
+            return x % 2 == 0;
+        });
+    });
+}
+
+void BenchmarkTimes(benchmark::State& state) {
+    auto n = static_cast<size_t>(state.range(0));
+    RunCounted(state, [n](std::pmr::memory_resource* resource) {
+        return lodash::Times(resource, n, [](size_t ix) {
+            return ix;
+        });
+    });
+}
+
+void BenchmarkReplace(benchmark::State& state) {
+    auto t = MakeInput(state.range(0));
+    RunCounted(state, [&t](std::pmr::memory_resource* resource) {
+        return lodash::ReplaceAll(resource, t, 4, 0);
+    });
+}
+
+void BenchmarkFlatten(benchmark::State& state) {
+    auto t = std::vector<std::vector<int>>(16, MakeInput(state.range(0) / 16));
+    RunCounted(state, [&t](std::pmr::memory_resource* resource) {
+        return lodash::Flatten(resource, t);
+    });
+}
+
+// BenchmarkFilterBranchy is the baseline for the compaction benchmarks: one branch per element.
+void BenchmarkFilterBranchy(benchmark::State& state) {
+    auto t = MakeRandomInput(state.range(0));
+    for (auto _ : state) {
+        auto res = std::vector<int>();
+        res.reserve(t.size());
+        for (auto&& v : t) {
+            if (v > 0) {
+                res.push_back(v);
+            }
+        }
+
+        benchmark::DoNotOptimize(res);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkFilterLambda(benchmark::State& state) {
+    auto t = MakeRandomInput(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lodash::Filter(t, [](int x) {
+            return x > 0;
+        }));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkFilterCompare(benchmark::State& state) {
+    auto t = MakeRandomInput(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lodash::Filter(t, lodash::Gt(0)));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkCompact(benchmark::State& state) {
+    auto t = lodash::Map(MakeRandomInput(state.range(0)), [](int x) {
+        return x > 0 ? x : 0;
+    });
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lodash::Compact(t));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BenchmarkPushBack)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BenchmarkMap)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BenchmarkFilter)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BenchmarkTimes)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BenchmarkReplace)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BenchmarkFlatten)->Arg(1 << 10)->Arg(1 << 16);
+
+BENCHMARK(BenchmarkFilterBranchy)->Arg(1 << 16);
+BENCHMARK(BenchmarkFilterLambda)->Arg(1 << 16);
+BENCHMARK(BenchmarkFilterCompare)->Arg(1 << 16);
+BENCHMARK(BenchmarkCompact)->Arg(1 << 16);
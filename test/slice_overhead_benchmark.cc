@@ -0,0 +1,237 @@
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+
+#include "./benchmark_util.h"
+#include "lodash/lodash.h"
+
+namespace lodash::bench {
+
+namespace {
+
+// The baselines build their results the way a caller would without lodash, e.g. `std::copy_if` into a
+// `std::back_inserter` for Filter.
+template <typename Container>
+void RegisterSequenceSuite() {
+    using T = typename Container::value_type;
+
+    RegisterPair<Container>(
+            "Map",
+            [](const Container& c) {
+                return Map(c, [](const T& v) {
+                    return Project(v);
+                });
+            },
+            [](const Container& c) {
+                auto res = std::vector<int64_t>();
+                res.reserve(c.size());
+                for (auto&& v : c) {
+                    res.push_back(Project(v));
+                }
+
+                return res;
+            });
+
+    RegisterPair<Container>(
+            "Filter",
+            [](const Container& c) {
+                return Filter(c, [](const T& v) {
+                    return Project(v) % 2 == 0;
+                });
+            },
+            [](const Container& c) {
+                auto res = Container();
+                std::copy_if(c.begin(), c.end(), std::back_inserter(res), [](const T& v) {
+                    return Project(v) % 2 == 0;
+                });
+
+                return res;
+            });
+
+    RegisterPair<Container>(
+            "Reduce",
+            [](const Container& c) {
+                return Reduce(
+                        c,
+                        [](int64_t acc, const T& v) {
+                            return acc + Project(v);
+                        },
+                        int64_t(0));
+            },
+            [](const Container& c) {
+                return std::accumulate(c.begin(), c.end(), int64_t(0), [](int64_t acc, const T& v) {
+                    return acc + Project(v);
+                });
+            });
+
+    RegisterPair<Container>(
+            "Uniq",
+            [](const Container& c) {
+                return Uniq(c);
+            },
+            [](const Container& c) {
+                auto se = std::unordered_set<T>();
+                se.reserve(c.size());
+
+                auto res = Container();
+                for (auto&& v : c) {
+                    if (se.insert(v).second) {
+                        res.push_back(v);
+                    }
+                }
+
+                return res;
+            });
+
+    RegisterPair<Container>(
+            "UniqBy",
+            [](const Container& c) {
+                return UniqBy(c, [](const T& v) {
+                    return Project(v) % 1024;
+                });
+            },
+            [](const Container& c) {
+                auto se = std::unordered_set<int64_t>();
+                auto res = Container();
+                for (auto&& v : c) {
+                    if (se.insert(Project(v) % 1024).second) {
+                        res.push_back(v);
+                    }
+                }
+
+                return res;
+            });
+
+    RegisterPair<Container>(
+            "Count",
+            [](const Container& c) {
+                const auto t = MakeValue<T>(0);
+                return Count(c, t);
+            },
+            [](const Container& c) {
+                const auto t = MakeValue<T>(0);
+                return std::count(c.begin(), c.end(), t);
+            });
+
+    RegisterPair<Container>(
+            "Replace",
+            [](const Container& c) {
+                const auto old_element = MakeValue<T>(0);
+                const auto new_element = MakeValue<T>(1);
+                return Replace(c, old_element, new_element);
+            },
+            [](const Container& c) {
+                const auto old_element = MakeValue<T>(0);
+                const auto new_element = MakeValue<T>(1);
+
+                auto res = c;
+                std::replace(res.begin(), res.end(), old_element, new_element);
+                return res;
+            });
+
+    // Flatten runs over n elements split in groups of 16.
+    RegisterPair<Container>(
+            "Flatten",
+            [](size_t n) {
+                auto groups = std::vector<Container>();
+                for (size_t i = 0; i < n; i += 16) {
+                    groups.push_back(MakeInput<Container>(std::min<size_t>(16, n - i), i));
+                }
+
+                return groups;
+            },
+            [](const std::vector<Container>& groups) {
+                return Flatten(groups);
+            },
+            [](const std::vector<Container>& groups) {
+                size_t size = 0;
+                for (auto&& g : groups) {
+                    size += g.size();
+                }
+
+                auto res = std::vector<T>();
+                res.reserve(size);
+                for (auto&& g : groups) {
+                    res.insert(res.end(), g.begin(), g.end());
+                }
+
+                return res;
+            });
+}
+
+template <typename Container>
+void RegisterMapSuite() {
+    using value_type = typename Container::value_type;
+    using mapped_type = typename Container::mapped_type;
+
+    RegisterPair<Container>(
+            "Map",
+            [](const Container& c) {
+                return Map(c, [](int, const mapped_type& m) {
+                    return Project(m);
+                });
+            },
+            [](const Container& c) {
+                auto res = std::vector<int64_t>();
+                res.reserve(c.size());
+                for (auto&& [k, m] : c) {
+                    res.push_back(Project(m));
+                }
+
+                return res;
+            });
+
+    RegisterPair<Container>(
+            "Filter",
+            [](const Container& c) {
+                return Filter(c, [](int, const mapped_type& m) {
+                    return Project(m) % 2 == 0;
+                });
+            },
+            [](const Container& c) {
+                auto res = Container();
+                std::copy_if(c.begin(), c.end(), std::inserter(res, res.end()), [](const value_type& v) {
+                    return Project(v) % 2 == 0;
+                });
+
+                return res;
+            });
+
+    RegisterPair<Container>(
+            "Reduce",
+            [](const Container& c) {
+                return Reduce(
+                        c,
+                        [](int64_t acc, const value_type& v) {
+                            return acc + Project(v);
+                        },
+                        int64_t(0));
+            },
+            [](const Container& c) {
+                return std::accumulate(c.begin(), c.end(), int64_t(0), [](int64_t acc, const value_type& v) {
+                    return acc + Project(v);
+                });
+            });
+}
+
+[[maybe_unused]] const bool kRegistered = [] {
+    ForEachSequenceContainer([](auto c) {
+        RegisterSequenceSuite<decltype(c)>();
+    });
+
+    ForEachMapContainer([](auto c) {
+        RegisterMapSuite<decltype(c)>();
+    });
+
+    return true;
+}();
+
+}  // namespace
+
+}  // namespace lodash::bench
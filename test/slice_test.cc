@@ -1,7 +1,17 @@
 #include "gtest/gtest.h"
 #include "snapshot/snapshot.h"
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <forward_list>
+#include <limits>
+#include <list>
 #include <map>
+#include <memory>
+#include <random>
+#include <type_traits>
 #include <vector>
 
 #include "lodash/lodash.h"
@@ -113,6 +123,40 @@ TEST_F(SliceTest, Filter) {
     }
 }
 
+// The lookup tables are computed by the compiler, the static_asserts fail to compile otherwise.
+TEST_F(SliceTest, ConstexprArray) {
+    constexpr auto t = std::array<int, 8>({3, 1, 4, 1, 5, 9, 2, 6});
+
+    constexpr auto squares = Map(RangeArray<16>(), [](int i) {
+        return i * i;
+    });
+    static_assert(std::is_same_v<decltype(squares), const std::array<int, 16>>);
+    static_assert(squares[0] == 0 && squares[15] == 225);
+
+    constexpr auto odd = Filter(t, [](int v) {
+        return v % 2 == 1;
+    });
+    static_assert(std::is_same_v<decltype(odd), const container::StaticVector<int, 8>>);
+    static_assert(odd.size() == 5 && odd[0] == 3 && odd[4] == 9);
+
+    constexpr auto large = Filter(t, Gt(4));
+    static_assert(large.size() == 3 && large.back() == 6);
+
+    // At run time, the same calls go through the instrumented and vectorized paths.
+    auto u = t;
+    EXPECT_EQ(Map(u,
+                  [](int v) {
+                      return v * 2;
+                  })[5],
+              18);
+    EXPECT_EQ(Filter(u,
+                     [](int v) {
+                         return v % 2 == 1;
+                     }),
+              odd);
+    EXPECT_EQ(Filter(u, Gt(4)), large);
+}
+
 TEST_F(SliceTest, Reject) {
     {
         auto t = std::vector<int>({1, 2, 3, 4, 5});
@@ -124,6 +168,76 @@ TEST_F(SliceTest, Reject) {
     }
 }
 
+template <typename T, typename P>
+void ExpectCompaction(const std::vector<T> &t, P p) {
+    auto filtered = std::vector<T>();
+    auto rejected = std::vector<T>();
+    for (auto &&v : t) {
+        (p(v) ? filtered : rejected).push_back(v);
+    }
+
+    // NaN does not compare equal to itself, so the values are compared by their bits.
+    auto same_bits = [](const std::vector<T> &a, const std::vector<T> &b) {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+    };
+
+    EXPECT_TRUE(same_bits(Filter(t, p), filtered));
+    EXPECT_TRUE(same_bits(Reject(t, p), rejected));
+}
+
+template <typename T>
+void ExpectCompactionForAll(const std::vector<T> &t, T v) {
+    ExpectCompaction(t, Eq(v));
+    ExpectCompaction(t, Ne(v));
+    ExpectCompaction(t, Lt(v));
+    ExpectCompaction(t, Lte(v));
+    ExpectCompaction(t, Gt(v));
+    ExpectCompaction(t, Gte(v));
+    ExpectCompaction(t, [v](const T &x) {
+        return x < v;
+    });
+}
+
+TEST_F(SliceTest, FilterCompaction) {
+    auto rnd = std::mt19937(42);
+
+    for (size_t n : {0, 1, 7, 8, 9, 16, 33, 100, 1000}) {
+        auto ints = std::vector<int32_t>(n);
+        auto longs = std::vector<int64_t>(n);
+        auto uints = std::vector<uint32_t>(n);
+        auto floats = std::vector<float>(n);
+        auto doubles = std::vector<double>(n);
+
+        for (size_t i = 0; i < n; i++) {
+            auto x = static_cast<int32_t>(rnd() % 16) - 8;
+            ints[i] = x;
+            longs[i] = int64_t(x) * (int64_t(1) << 33);
+            uints[i] = static_cast<uint32_t>(x);
+            floats[i] = static_cast<float>(x) / 2;
+            doubles[i] = static_cast<double>(x) / 2;
+        }
+
+        if (n > 0) {
+            floats[n / 2] = std::numeric_limits<float>::quiet_NaN();
+            doubles[n / 2] = std::numeric_limits<double>::quiet_NaN();
+        }
+
+        ExpectCompactionForAll<int32_t>(ints, 3);
+        ExpectCompactionForAll<int64_t>(longs, -(int64_t(1) << 33));
+        ExpectCompactionForAll<uint32_t>(uints, 2);
+        ExpectCompactionForAll<float>(floats, 0.5f);
+        ExpectCompactionForAll<double>(doubles, -1.5);
+
+        ExpectCompaction(longs, Gt(0));
+    }
+
+    {
+        auto t = std::string("a-b--c");
+        EXPECT_EQ(Filter(t, Ne('-')), "abc");
+        EXPECT_EQ(Reject(t, Ne('-')), "---");
+    }
+}
+
 TEST_F(SliceTest, ForEach) {
     {
         auto x = std::vector<int>({1, 2, 3, 4, 5});
@@ -226,6 +340,41 @@ TEST_F(SliceTest, Flatten) {
     }
 }
 
+TEST_F(SliceTest, FlattenDepth) {
+    const auto t = std::vector<std::vector<std::list<int>>>({{{1, 2}, {3}}, {}, {{}, {4}}});
+
+    {
+        auto res = FlattenDepth<0>(t);
+        EXPECT_EQ(res, t);
+    }
+
+    {
+        auto res = FlattenDepth<1>(t);
+        auto expected = std::vector<std::list<int>>({{1, 2}, {3}, {}, {4}});
+        EXPECT_EQ(res, expected);
+        EXPECT_EQ(res.capacity(), 4);
+    }
+
+    {
+        auto res = FlattenDepth<2>(t);
+        auto expected = std::vector<int>({1, 2, 3, 4});
+        EXPECT_EQ(res, expected);
+        EXPECT_EQ(res.capacity(), 4);
+    }
+
+    {
+        auto res = FlattenDepth<5>(t);
+        EXPECT_EQ(res, Flatten(t));
+    }
+
+    {
+        auto u = t;
+        auto res = FlattenDepth<1>(std::move(u));
+        EXPECT_EQ(res.size(), 4);
+        EXPECT_EQ(res[0], std::list<int>({1, 2}));
+    }
+}
+
 TEST_F(SliceTest, Times) {
     {
         auto res = Times(3, [](size_t ix) {
@@ -258,6 +407,20 @@ TEST_F(SliceTest, Uniq) {
         auto expected = std::vector<int>({2, 3, 1, 5, 4});
         EXPECT_EQ(res, expected);
     }
+
+    {
+        auto t = std::vector<std::string>({"b", "a", "b", "c", "a"});
+        auto res = Uniq(t);
+        auto expected = std::vector<std::string>({"b", "a", "c"});
+        EXPECT_EQ(res, expected);
+    }
+
+    {
+        auto t = std::vector<std::vector<int>>({{2}, {1}, {2}, {1, 2}});
+        auto res = Uniq(t);
+        auto expected = std::vector<std::vector<int>>({{2}, {1}, {1, 2}});
+        EXPECT_EQ(res, expected);
+    }
 }
 
 TEST_F(SliceTest, UniqBy) {
@@ -315,6 +478,13 @@ TEST_F(SliceTest, Replace) {
 }
 
 TEST_F(SliceTest, Compact) {
+    {
+        auto t = std::vector<double>({0.0, 1.5, -0.0, 2.5, 0.0, 0.0, 0.0, 0.0, 0.0, 3.5});
+        auto res = Compact(t);
+        auto expected = std::vector<double>({1.5, 2.5, 3.5});
+        EXPECT_EQ(res, expected);
+    }
+
     {
         auto t = std::vector<int>({0, 1, 2, 3, 0, 5, 6});
         auto res = Compact(t);
@@ -330,4 +500,229 @@ TEST_F(SliceTest, Compact) {
     }
 }
 
+TEST_F(SliceTest, Reserve) {
+    const auto t = Times(1000, [](size_t ix) {
+        return static_cast<int>(ix);
+    });
+    EXPECT_EQ(t.capacity(), 1000);
+
+    {
+        auto res = Map(t, [](int x) {
+            return x * 2;
+        });
+        EXPECT_EQ(res.capacity(), 1000);
+    }
+
+    {
+        auto res = Filter(t, [](int x) {
+            return x % 2 == 0;
+        });
+        EXPECT_EQ(res.size(), 500);
+        EXPECT_EQ(res.capacity(), 1000);
+    }
+
+    {
+        auto res = Replace(t, 4, 0);
+        EXPECT_EQ(res.capacity(), 1000);
+    }
+
+    {
+        auto res = Flatten(std::vector<std::vector<int>>({t, {}, t}));
+        EXPECT_EQ(res.size(), 2000);
+        EXPECT_EQ(res.capacity(), 2000);
+    }
+}
+
+TEST_F(SliceTest, FilterInPlace) {
+    auto is_even = [](int x) {
+        return x % 2 == 0;
+    };
+
+    {
+        auto t = std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18});
+        auto data = t.data();
+        auto capacity = t.capacity();
+
+        FilterInPlace(t, is_even);
+        EXPECT_EQ(t, std::vector<int>({2, 4, 6, 8, 10, 12, 14, 16, 18}));
+        EXPECT_EQ(t.data(), data);
+        EXPECT_EQ(t.capacity(), capacity);
+    }
+
+    {
+        auto t = std::vector<int>({5, 1, 6, 2, 7, 3, 8, 4, 9, 0, 10, 11, 12, 13, 14, 15, 16, 17});
+        FilterInPlace(t, Gt(8));
+        EXPECT_EQ(t, std::vector<int>({9, 10, 11, 12, 13, 14, 15, 16, 17}));
+    }
+
+    {
+        auto t = std::vector<std::string>({"a", "bb", "ccc", "dd"});
+        FilterInPlace(t, [](const std::string &s, size_t ix) {
+            return s.size() == 2 || ix == 0;
+        });
+        EXPECT_EQ(t, std::vector<std::string>({"a", "bb", "dd"}));
+    }
+
+    {
+        auto t = std::deque<int>({1, 2, 3, 4});
+        RejectInPlace(t, is_even);
+        EXPECT_EQ(t, std::deque<int>({1, 3}));
+    }
+
+    {
+        auto t = std::list<int>({1, 2, 3, 4});
+        FilterInPlace(t, is_even);
+        EXPECT_EQ(t, std::list<int>({2, 4}));
+    }
+
+    {
+        auto t = std::forward_list<int>({2, 1, 2, 3, 4});
+        FilterInPlace(t, is_even);
+        EXPECT_EQ(t, std::forward_list<int>({2, 2, 4}));
+    }
+
+    {
+        auto t = std::map<int, int>({{1, 2}, {2, 3}, {3, 4}, {4, 5}});
+        FilterInPlace(t, [](const int &k, const int &v) {
+            return k >= 3 || v >= 3;
+        });
+        EXPECT_EQ(t, (std::map<int, int>({{2, 3}, {3, 4}, {4, 5}})));
+    }
+}
+
+TEST_F(SliceTest, UniqInPlace) {
+    {
+        auto t = std::vector<int>({2, 2, 3, 3, 1, 1, 5, 5, 4, 4, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 9});
+        UniqInPlace(t);
+        EXPECT_EQ(t, std::vector<int>({2, 3, 1, 5, 4, 6, 7, 8, 9}));
+    }
+
+    {
+        auto t = std::vector<std::string>({"b", "a", "b", "c", "a"});
+        UniqInPlace(t);
+        EXPECT_EQ(t, std::vector<std::string>({"b", "a", "c"}));
+    }
+
+    {
+        auto t = std::list<std::vector<int>>({{1}, {2}, {1}});
+        UniqInPlace(t);
+        EXPECT_EQ(t, std::list<std::vector<int>>({{1}, {2}}));
+    }
+}
+
+TEST_F(SliceTest, ReplaceInPlace) {
+    {
+        auto t = std::vector<int>({1, 2, 3, 4, 5, 4, 3, 4, 1});
+        ReplaceInPlace(t, 4, 0, 2);
+        EXPECT_EQ(t, std::vector<int>({1, 2, 3, 0, 5, 0, 3, 4, 1}));
+
+        ReplaceInPlace(t, 4, 0);
+        EXPECT_EQ(t, std::vector<int>({1, 2, 3, 0, 5, 0, 3, 0, 1}));
+    }
+
+    {
+        auto t = std::string("abcdcba");
+        ReplaceInPlace(t, 'a', 'c');
+        EXPECT_EQ(t, "cbcdcbc");
+    }
+}
+
+TEST_F(SliceTest, CompactInPlace) {
+    {
+        auto t = std::vector<int>({0, 1, 2, 3, 0, 5, 6});
+        CompactInPlace(t);
+        EXPECT_EQ(t, std::vector<int>({1, 2, 3, 5, 6}));
+    }
+
+    {
+        auto t = std::vector<std::string>({"", "1", "", "2", "", "3"});
+        CompactInPlace(t);
+        EXPECT_EQ(t, std::vector<std::string>({"1", "2", "3"}));
+    }
+}
+
+TEST_F(SliceTest, Rvalue) {
+    auto make = [] {
+        return std::vector<int>({0, 1, 2, 2, 3, 0, 4, 4, 5});
+    };
+
+    {
+        auto t = make();
+        auto data = t.data();
+        auto res = Filter(std::move(t), Gt(2));
+        EXPECT_EQ(res, std::vector<int>({3, 4, 4, 5}));
+        EXPECT_EQ(res.data(), data);
+    }
+
+    {
+        auto t = make();
+        auto data = t.data();
+        auto res = Reject(std::move(t), [](int x, size_t ix) {
+            return x == 0 || ix > 6;
+        });
+        EXPECT_EQ(res, std::vector<int>({1, 2, 2, 3, 4}));
+        EXPECT_EQ(res.data(), data);
+    }
+
+    {
+        auto t = make();
+        auto data = t.data();
+        auto res = Map(std::move(t), [](int x) {
+            return x * 2;
+        });
+        EXPECT_EQ(res, std::vector<int>({0, 2, 4, 4, 6, 0, 8, 8, 10}));
+        EXPECT_EQ(res.data(), data);
+    }
+
+    {
+        auto t = make();
+        auto data = t.data();
+        auto res = Compact(Uniq(Replace(std::move(t), 2, 0, 1)));
+        EXPECT_EQ(res, std::vector<int>({1, 2, 3, 4, 5}));
+        EXPECT_EQ(res.data(), data);
+    }
+
+    {
+        auto t = std::vector<std::vector<std::unique_ptr<int>>>(2);
+        t[0].push_back(std::make_unique<int>(1));
+        t[1].push_back(std::make_unique<int>(2));
+        t[1].push_back(std::make_unique<int>(3));
+
+        auto res = Flatten(std::move(t));
+        EXPECT_EQ(res.size(), 3);
+        EXPECT_EQ(*res[2], 3);
+    }
+
+    {
+        const auto t = make();
+        auto res = Filter(t, Gt(2));
+        EXPECT_EQ(t, make());
+        EXPECT_EQ(res, std::vector<int>({3, 4, 4, 5}));
+    }
+}
+
+TEST_F(SliceTest, RvalueResultType) {
+    using V = std::vector<int>;
+    auto make = [] {
+        return V({0, 1, 2, 2, 3, 0, 4, 4, 5});
+    };
+
+    {
+        auto t = make();
+        auto data = t.data();
+        auto res = Filter<V>(std::move(t), Gt(2));
+        EXPECT_EQ(res, V({3, 4, 4, 5}));
+        EXPECT_EQ(res.data(), data);
+    }
+
+    EXPECT_EQ(Filter<V>(make(), Gt(2)), V({3, 4, 4, 5}));
+    EXPECT_EQ(Reject<V>(make(), Gt(2)), V({0, 1, 2, 2, 0}));
+    EXPECT_EQ(Uniq<V>(make()), V({0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(Intersect<V>(make(), V({2, 7})), V({2}));
+    EXPECT_EQ(Map<V>(make(), [](int x) {
+                  return x * 2;
+              }),
+              V({0, 2, 4, 4, 6, 0, 8, 8, 10}));
+}
+
 }  // namespace lodash::test
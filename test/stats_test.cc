@@ -0,0 +1,199 @@
+#include "gtest/gtest.h"
+
+#include <forward_list>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lodash/lodash.h"
+
+namespace lodash::test {
+
+using stats::Algorithm;
+
+class StatsTest : public testing::Test {
+protected:
+    virtual void SetUp() override {
+        if (!stats::kEnabled) {
+            GTEST_SKIP() << "LODASH_ENABLE_STATS is not defined";
+        }
+
+        before = stats::GetSnapshot();
+    }
+
+    // Recorded returns the counters recorded for the algorithm since SetUp.
+    stats::AlgorithmStats Recorded(Algorithm algorithm) {
+        return (stats::GetSnapshot() - before)[algorithm];
+    }
+
+    stats::Snapshot before;
+};
+
+TEST_F(StatsTest, Slice) {
+    const auto t = std::vector<int>({1, 0, 2, 2, 3, 0, 4, 5, 5});
+
+    Filter(t, [](int x) {
+        return x % 2 == 0;
+    });
+
+    Map(std::list<int>({1, 2, 3}), [](int x) {
+        return x * 2;
+    });
+
+    {
+        auto res = Recorded(Algorithm::kFilter);
+        EXPECT_EQ(res.calls, 1);
+        EXPECT_EQ(res.elements, 9);
+        EXPECT_EQ(res.early_exits, 0);
+        EXPECT_EQ(res.result_elements, 5);
+        EXPECT_EQ(res.scratch_elements, 0);
+    }
+
+    {
+        auto res = Recorded(Algorithm::kMap);
+        EXPECT_EQ(res.calls, 1);
+        EXPECT_EQ(res.elements, 3);
+        EXPECT_EQ(res.result_elements, 3);
+    }
+
+    {
+        Uniq(t);
+
+        auto res = Recorded(Algorithm::kUniq);
+        EXPECT_EQ(res.calls, 1);
+        EXPECT_EQ(res.elements, 9);
+        EXPECT_EQ(res.result_elements, 6);
+        EXPECT_EQ(res.scratch_elements, 6);
+    }
+
+    {
+        auto c = std::forward_list<int>({1, 2, 3, 4});
+        FilterInPlace(c, Gt(2));
+
+        auto res = Recorded(Algorithm::kFilterInPlace);
+        EXPECT_EQ(res.calls, 1);
+        EXPECT_EQ(res.elements, 4);
+        EXPECT_EQ(res.result_elements, 2);
+    }
+
+    {
+        auto c = std::vector<int>({1, 2, 1, 2, 1});
+        ReplaceInPlace(c, 1, 3, 2);
+
+        auto res = Recorded(Algorithm::kReplaceInPlace);
+        EXPECT_EQ(c, std::vector<int>({3, 2, 3, 2, 1}));
+        EXPECT_EQ(res.elements, 3);
+        EXPECT_EQ(res.early_exits, 1);
+    }
+}
+
+TEST_F(StatsTest, delegation) {
+    const auto t = std::vector<int>({1, 0, 2, 0, 3});
+
+    Compact(t);
+    Count(t, 0);
+
+    {
+        auto res = Recorded(Algorithm::kCompact);
+        EXPECT_EQ(res.calls, 1);
+        EXPECT_EQ(res.elements, 5);
+        EXPECT_EQ(res.result_elements, 3);
+    }
+
+    {
+        auto res = Recorded(Algorithm::kCount);
+        EXPECT_EQ(res.calls, 1);
+        EXPECT_EQ(res.elements, 5);
+    }
+
+    EXPECT_EQ(Recorded(Algorithm::kFilter).calls, 0);
+    EXPECT_EQ(Recorded(Algorithm::kCountBy).calls, 0);
+}
+
+TEST_F(StatsTest, early_exit) {
+    const auto t = std::vector<int>({1, 2, 3, 4, 5});
+
+    EXPECT_TRUE(Contains(t, 2));
+    EXPECT_FALSE(Contains(t, 6));
+    EXPECT_FALSE(EveryBy(t, Lt(3)));
+    EXPECT_TRUE(SomeBy(t, Gt(4)));
+    EXPECT_TRUE(NoneBy(t, Gt(5)));
+
+    {
+        auto res = Recorded(Algorithm::kContains);
+        EXPECT_EQ(res.calls, 2);
+        EXPECT_EQ(res.elements, 2 + 5);
+        EXPECT_EQ(res.early_exits, 1);
+    }
+
+    {
+        auto res = Recorded(Algorithm::kEveryBy);
+        EXPECT_EQ(res.elements, 3);
+        EXPECT_EQ(res.early_exits, 1);
+    }
+
+    {
+        auto res = Recorded(Algorithm::kSomeBy);
+        EXPECT_EQ(res.elements, 5);
+        EXPECT_EQ(res.early_exits, 1);
+    }
+
+    {
+        auto res = Recorded(Algorithm::kNoneBy);
+        EXPECT_EQ(res.elements, 5);
+        EXPECT_EQ(res.early_exits, 0);
+    }
+}
+
+TEST_F(StatsTest, Set) {
+    Intersect(std::vector<int>({1, 2, 3, 4}), std::vector<int>({3, 4, 5}));
+    IntersectSorted(std::vector<int>({1, 2, 3, 4}), std::vector<int>({3, 4, 5}));
+
+    {
+        auto res = Recorded(Algorithm::kIntersect);
+        EXPECT_EQ(res.calls, 1);
+        EXPECT_EQ(res.elements, 7);
+        EXPECT_EQ(res.result_elements, 2);
+        EXPECT_EQ(res.scratch_elements, 4);
+    }
+
+    {
+        // The merge stops when the first input is exhausted, before 5.
+        auto res = Recorded(Algorithm::kIntersectSorted);
+        EXPECT_EQ(res.elements, 6);
+        EXPECT_EQ(res.result_elements, 2);
+        EXPECT_EQ(res.scratch_elements, 0);
+    }
+}
+
+TEST_F(StatsTest, threads) {
+    auto t = std::vector<std::string>({"a", "b", "a"});
+
+    auto threads = std::vector<std::thread>();
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&t] {
+            Uniq(t);
+        });
+    }
+
+    // The counters of the running threads are aggregated as well as the ones of the exited threads.
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    Uniq(t);
+
+    auto res = Recorded(Algorithm::kUniq);
+    EXPECT_EQ(res.calls, 5);
+    EXPECT_EQ(res.elements, 15);
+    EXPECT_EQ(res.result_elements, 10);
+}
+
+TEST_F(StatsTest, GetAlgorithmName) {
+    EXPECT_EQ(std::string(stats::GetAlgorithmName(Algorithm::kMap)), "Map");
+    EXPECT_EQ(std::string(stats::GetAlgorithmName(Algorithm::kReplaceInPlace)), "ReplaceInPlace");
+    EXPECT_EQ(std::string(stats::GetAlgorithmName(Algorithm::kRange)), "Range");
+}
+
+}  // namespace lodash::test
@@ -0,0 +1,189 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lodash/lodash.h"
+
+namespace lodash::test {
+
+class StreamTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+
+    // Counter returns a generator of the ints in [0, n).
+    static auto Counter(int n) {
+        return [i = 0, n]() mutable -> std::optional<int> {
+            if (i == n) {
+                return std::nullopt;
+            }
+
+            return i++;
+        };
+    }
+};
+
+TEST_F(StreamTest, ForEachChunk) {
+    {
+        auto chunks = std::vector<std::vector<int>>();
+        ForEachChunk(
+                FromGenerator(Counter(7)),
+                [&chunks](std::vector<int>& chunk) {
+                    chunks.push_back(chunk);
+                },
+                3);
+
+        EXPECT_EQ(chunks, std::vector<std::vector<int>>({{0, 1, 2}, {3, 4, 5}, {6}}));
+    }
+
+    {
+        auto chunks = std::vector<std::vector<int>>();
+        ForEachChunk(
+                FromGenerator(Counter(6)),
+                [&chunks](std::vector<int>& chunk) {
+                    chunks.push_back(chunk);
+                },
+                3);
+
+        EXPECT_EQ(chunks, std::vector<std::vector<int>>({{0, 1, 2}, {3, 4, 5}}));
+    }
+
+    {
+        size_t count = 0;
+        ForEachChunk(FromGenerator(Counter(0)), [&count](std::vector<int>&) {
+            ++count;
+        });
+
+        EXPECT_EQ(count, 0);
+    }
+
+    // The chunk buffer is reused, its capacity is the chunk size.
+    {
+        auto data = std::vector<const int*>();
+        ForEachChunk(
+                FromGenerator(Counter(10)),
+                [&data](std::vector<int>& chunk) {
+                    EXPECT_EQ(chunk.capacity(), 4);
+                    data.push_back(chunk.data());
+                },
+                4);
+
+        EXPECT_EQ(data, std::vector<const int*>(3, data[0]));
+    }
+}
+
+TEST_F(StreamTest, istream) {
+    {
+        auto is = std::istringstream("1 2 3 4 5");
+        auto res = ReduceChunks(
+                FromIstream<int>(is),
+                [](int acc, int x) {
+                    return acc + x;
+                },
+                0,
+                2);
+
+        EXPECT_EQ(res, 15);
+    }
+
+    {
+        auto is = std::istringstream("a bb ccc dddd");
+        auto res = std::vector<size_t>();
+        MapChunks(
+                FromIterators(std::istream_iterator<std::string>(is), std::istream_iterator<std::string>()),
+                [](const std::string& s) {
+                    return s.size();
+                },
+                [&res](std::vector<size_t>& sizes) {
+                    res.insert(res.end(), sizes.begin(), sizes.end());
+                },
+                3);
+
+        EXPECT_EQ(res, std::vector<size_t>({1, 2, 3, 4}));
+    }
+}
+
+TEST_F(StreamTest, MapChunks) {
+    auto res = std::vector<std::string>();
+    MapChunks(
+            FromGenerator(Counter(5)),
+            [](int x, size_t ix) {
+                return std::to_string(x * 10 + static_cast<int>(ix));
+            },
+            [&res](std::vector<std::string>& chunk) {
+                EXPECT_LE(chunk.size(), 2);
+                res.insert(res.end(), chunk.begin(), chunk.end());
+            },
+            2);
+
+    EXPECT_EQ(res, std::vector<std::string>({"0", "11", "22", "33", "44"}));
+}
+
+TEST_F(StreamTest, FilterChunks) {
+    auto t = std::vector<int>({1, 3, 5, 2, 4, 7, 9, 6});
+    auto res = std::vector<int>();
+    size_t chunks = 0;
+
+    FilterChunks(
+            FromIterators(t.begin(), t.end()),
+            [](int x) {
+                return x % 2 == 0;
+            },
+            [&](std::vector<int>& chunk) {
+                ++chunks;
+                res.insert(res.end(), chunk.begin(), chunk.end());
+            },
+            3);
+
+    EXPECT_EQ(res, std::vector<int>({2, 4, 6}));
+    EXPECT_EQ(chunks, 2);
+}
+
+TEST_F(StreamTest, FilterChunksIndex) {
+    auto t = Range(10, 20);
+    auto indexes = std::vector<size_t>();
+    auto res = std::vector<int>();
+
+    FilterChunks(
+            FromIterators(t.begin(), t.end()),
+            [&](int x, size_t ix) {
+                indexes.push_back(ix);
+                return x % 3 == 0 || ix == 9;
+            },
+            [&](std::vector<int>& chunk) {
+                res.insert(res.end(), chunk.begin(), chunk.end());
+            },
+            4);
+
+    EXPECT_EQ(indexes, std::vector<size_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_EQ(res, std::vector<int>({12, 15, 18, 19}));
+}
+
+TEST_F(StreamTest, ReduceChunks) {
+    auto res = ReduceChunks(
+            FromGenerator(Counter(100)),
+            [](std::string acc, int x, size_t ix) {
+                return x % 25 == 0 ? acc + std::to_string(ix) + "," : acc;
+            },
+            std::string(),
+            7);
+
+    EXPECT_EQ(res, "0,25,50,75,");
+}
+
+TEST_F(StreamTest, CountByChunks) {
+    EXPECT_EQ(CountByChunks(FromGenerator(Counter(1000)), Gt(899), 64), 100);
+    EXPECT_EQ(CountByChunks(
+                      FromGenerator(Counter(1000)),
+                      [](int, size_t ix) {
+                          return ix % 10 == 0;
+                      },
+                      0),
+              100);
+}
+
+}  // namespace lodash::test
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "snapshot/snapshot.h"
 
+#include <string>
 #include <vector>
 
 #include "lodash/lodash.h"
@@ -43,4 +44,14 @@ TEST_F(HasFuncArgsTest, has_func_args) {
     }
 }
 
+TEST_F(HasFuncArgsTest, variadic) {
+    auto f = []([[maybe_unused]] int& x, [[maybe_unused]] const std::string& s, [[maybe_unused]] size_t ix) {};
+
+    EXPECT_TRUE((has_func_args<decltype(f)&, int&, std::string, size_t>));
+    EXPECT_FALSE((has_func_args<decltype(f)&, int&, std::string>));
+    EXPECT_FALSE((has_func_args<decltype(f)&, const int&, std::string, size_t>));
+    EXPECT_TRUE((has_func_args<void (*)()>));
+    EXPECT_FALSE((has_func_args<int>));
+}
+
 }  // namespace lodash::type_check::test
@@ -0,0 +1,34 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <string>
+#include <vector>
+
+#include "lodash/lodash.h"
+#include "lodash/type_check/is_hashable.h"
+
+namespace lodash::type_check::test {
+
+class IsHashableTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+};
+
+TEST_F(IsHashableTest, is_hashable) {
+    {
+        auto res = is_hashable<int>;
+        EXPECT_TRUE(res);
+    }
+
+    {
+        auto res = is_hashable<std::string>;
+        EXPECT_TRUE(res);
+    }
+
+    {
+        auto res = is_hashable<std::vector<int>>;
+        EXPECT_FALSE(res);
+    }
+}
+
+}  // namespace lodash::type_check::test
@@ -0,0 +1,34 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <array>
+#include <vector>
+
+#include "lodash/lodash.h"
+#include "lodash/type_check/is_std_array.h"
+
+namespace lodash::type_check::test {
+
+class IsStdArrayTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+};
+
+TEST_F(IsStdArrayTest, is_std_array) {
+    {
+        auto res = is_std_array<std::array<int, 3>>;
+        EXPECT_TRUE(res);
+    }
+
+    {
+        auto res = is_std_array<std::vector<int>>;
+        EXPECT_FALSE(res);
+    }
+
+    {
+        auto res = is_std_array<int[3]>;
+        EXPECT_FALSE(res);
+    }
+}
+
+}  // namespace lodash::type_check::test
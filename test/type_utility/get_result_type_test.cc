@@ -2,6 +2,8 @@
 #include "snapshot/snapshot.h"
 
 #include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "lodash/lodash.h"
@@ -44,6 +46,17 @@ TEST_F(GetResultTypeTest, get_result_type) {
         auto res = std::is_same_v<t, int>;
         EXPECT_TRUE(res);
     }
+
+    {
+        // A generic callback accepts the pair of a map element first, as VisitContainer invokes it.
+        auto f = [](auto&& x) {
+            return x;
+        };
+
+        using t = get_result_type_t<std::map<std::string, int>, decltype(f)>;
+        auto res = std::is_same_v<t, std::pair<const std::string, int>>;
+        EXPECT_TRUE(res);
+    }
 }
 
 }  // namespace lodash::type_utility::test
@@ -0,0 +1,151 @@
+#include "gtest/gtest.h"
+#include "snapshot/snapshot.h"
+
+#include <array>
+#include <forward_list>
+#include <list>
+#include <map>
+#include <vector>
+
+#include "lodash/lodash.h"
+#include "lodash/type_utility/visit_container.h"
+
+namespace lodash::type_utility::test {
+
+class VisitContainerTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+};
+
+// NodeInfoRecorder declares kNeedNodeInfo, so it is passed a NodeInfo for each element.
+struct NodeInfoRecorder {
+    static constexpr bool kNeedNodeInfo = true;
+
+    std::vector<size_t>* ixs;
+    std::vector<size_t>* firsts;
+    std::vector<size_t>* lasts;
+
+    template <typename R, typename V>
+    ReturnInfo operator()([[maybe_unused]] R&& r, [[maybe_unused]] V&& v, const NodeInfo& node_info) {
+        ixs->push_back(node_info.ix);
+        if (node_info.is_first) {
+            firsts->push_back(node_info.ix);
+        }
+
+        if (node_info.is_last) {
+            lasts->push_back(node_info.ix);
+        }
+
+        return ReturnInfo{};
+    }
+};
+
+TEST_F(VisitContainerTest, node_info) {
+    auto identity = [](int x) {
+        return x;
+    };
+
+    auto check = [&identity](auto&& c) {
+        auto ixs = std::vector<size_t>();
+        auto firsts = std::vector<size_t>();
+        auto lasts = std::vector<size_t>();
+
+        VisitContainer(c, identity, NodeInfoRecorder{&ixs, &firsts, &lasts});
+        EXPECT_EQ(ixs, std::vector<size_t>({0, 1, 2}));
+        EXPECT_EQ(firsts, std::vector<size_t>({0}));
+        EXPECT_EQ(lasts, std::vector<size_t>({2}));
+    };
+
+    check(std::vector<int>({1, 2, 3}));
+    check(std::list<int>({1, 2, 3}));
+    check(std::forward_list<int>({1, 2, 3}));
+
+    {
+        auto res = need_node_info_v<NodeInfoRecorder>;
+        EXPECT_TRUE(res);
+
+        res = need_node_info_v<decltype(default_visit_handler)>;
+        EXPECT_FALSE(res);
+    }
+}
+
+TEST_F(VisitContainerTest, forward_list) {
+    auto t = std::forward_list<int>({1, 2, 3, 4, 5});
+
+    {
+        auto res = Map(t, [](int x, size_t ix) {
+            return x * 10 + static_cast<int>(ix);
+        });
+        EXPECT_EQ(res, std::vector<int>({10, 21, 32, 43, 54}));
+    }
+
+    {
+        auto res = CountBy(t, [](int x) {
+            return x % 2 == 1;
+        });
+        EXPECT_EQ(res, 3);
+    }
+
+    {
+        auto res = Reduce(
+                t,
+                [](int pre, int x) {
+                    return pre + x;
+                },
+                0);
+        EXPECT_EQ(res, 15);
+    }
+
+    {
+        auto res = std::vector<int>();
+        ForEach(t, [&res](int x) {
+            res.push_back(x);
+        });
+        EXPECT_EQ(res, std::vector<int>({1, 2, 3, 4, 5}));
+    }
+}
+
+TEST_F(VisitContainerTest, need_exit) {
+    auto t = std::vector<int>({1, 2, 3, 4, 5});
+    auto seen = std::vector<int>();
+
+    VisitContainer(
+            t,
+            [&seen](int x) {
+                seen.push_back(x);
+                return x;
+            },
+            []([[maybe_unused]] auto&& r, [[maybe_unused]] auto&& v, [[maybe_unused]] auto&& node_info) {
+                return ReturnInfo{r == 3};
+            });
+
+    EXPECT_EQ(seen, std::vector<int>({1, 2, 3}));
+}
+
+// CountUntil counts the elements of an array visited until one is equal to stop, in a constant expression.
+template <size_t N>
+constexpr size_t CountUntil(const std::array<int, N>& t, int stop) {
+    size_t count = 0;
+
+    VisitContainer(
+            t,
+            [&count](int x) {
+                ++count;
+                return x;
+            },
+            [stop]([[maybe_unused]] auto&& r, [[maybe_unused]] auto&& v, [[maybe_unused]] auto&& node_info) {
+                return ReturnInfo{r == stop};
+            });
+
+    return count;
+}
+
+TEST_F(VisitContainerTest, constexpr_array) {
+    constexpr auto t = std::array<int, 5>({1, 2, 3, 4, 5});
+
+    static_assert(CountUntil(t, 3) == 3);
+    static_assert(CountUntil(t, 6) == 5);
+    EXPECT_EQ(CountUntil(t, 4), 4);
+}
+
+}  // namespace lodash::type_utility::test
@@ -0,0 +1,34 @@
+#include "gtest/gtest.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "lodash/type_utility/visitor_form.h"
+
+namespace lodash::type_utility::test {
+
+class VisitorFormTest : public testing::Test {
+protected:
+    virtual void SetUp() override {}
+};
+
+TEST_F(VisitorFormTest, visitor_form) {
+    auto value = []([[maybe_unused]] int& x) {};
+    auto value_index = []([[maybe_unused]] int& x, [[maybe_unused]] size_t ix) {};
+    auto key_mapped = []([[maybe_unused]] const std::string& key, [[maybe_unused]] int& x) {};
+    auto key_mapped_index = []([[maybe_unused]] const std::string& key,
+                               [[maybe_unused]] int& x,
+                               [[maybe_unused]] size_t ix) {};
+    auto generic = []([[maybe_unused]] auto&&... args) {};
+
+    EXPECT_EQ((visitor_form_v<std::vector<int>, decltype(value)&>), VisitorForm::kValue);
+    EXPECT_EQ((visitor_form_v<const std::vector<int>&, decltype(value_index)&>), VisitorForm::kValueIndex);
+    EXPECT_EQ((visitor_form_v<std::vector<int>, decltype(key_mapped)&>), VisitorForm::kNone);
+    EXPECT_EQ((visitor_form_v<std::map<std::string, int>, decltype(key_mapped)&>), VisitorForm::kKeyMapped);
+    EXPECT_EQ((visitor_form_v<std::map<std::string, int>, decltype(key_mapped_index)&>),
+              VisitorForm::kKeyMappedIndex);
+    EXPECT_EQ((visitor_form_v<std::map<std::string, int>, decltype(generic)&>), VisitorForm::kValueIndex);
+}
+
+}  // namespace lodash::type_utility::test
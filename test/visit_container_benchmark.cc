@@ -0,0 +1,106 @@
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <forward_list>
+#include <vector>
+
+#include "lodash/lodash.h"
+
+namespace {
+
+std::vector<int> MakeInput(size_t n) {
+    return lodash::Times(n, [](size_t ix) {
+        return static_cast<int>(ix * 7 % 13);
+    });
+}
+
+// The Raw benchmarks are the hand-written loops ForEach and CountBy are expected to match.
+void BenchmarkRawLoopSum(benchmark::State& state) {
+    auto t = MakeInput(state.range(0));
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < t.size(); i++) {
+            sum += t[i];
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkForEachSum(benchmark::State& state) {
+    auto t = MakeInput(state.range(0));
+    for (auto _ : state) {
+        int64_t sum = 0;
+        lodash::ForEach(t, [&sum](int x) {
+            sum += x;
+        });
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkRawLoopCount(benchmark::State& state) {
+    auto t = MakeInput(state.range(0));
+    for (auto _ : state) {
+        size_t count = 0;
+        for (size_t i = 0; i < t.size(); i++) {
+            count += t[i] > 6;
+        }
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkCountBy(benchmark::State& state) {
+    auto t = MakeInput(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lodash::CountBy(t, [](int x) {
+            return x > 6;
+        }));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkRawLoopCountForwardList(benchmark::State& state) {
+    auto v = MakeInput(state.range(0));
+    auto t = std::forward_list<int>(v.begin(), v.end());
+    for (auto _ : state) {
+        size_t count = 0;
+        for (auto&& x : t) {
+            count += x > 6;
+        }
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkCountByForwardList(benchmark::State& state) {
+    auto v = MakeInput(state.range(0));
+    auto t = std::forward_list<int>(v.begin(), v.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lodash::CountBy(t, [](int x) {
+            return x > 6;
+        }));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BenchmarkRawLoopSum)->Arg(1 << 16);
+BENCHMARK(BenchmarkForEachSum)->Arg(1 << 16);
+BENCHMARK(BenchmarkRawLoopCount)->Arg(1 << 16);
+BENCHMARK(BenchmarkCountBy)->Arg(1 << 16);
+BENCHMARK(BenchmarkRawLoopCountForwardList)->Arg(1 << 16);
+BENCHMARK(BenchmarkCountByForwardList)->Arg(1 << 16);